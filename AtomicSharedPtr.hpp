@@ -0,0 +1,196 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Atomic shared pointer
+ */
+
+#pragma once
+
+#include "Assert.hpp"
+#include "SharedPtr.hpp"
+
+/** @brief Shared pointer that can be loaded and replaced concurrently without lock
+ *  The data pointer is packed with a count of references acquired by readers (split reference counting).
+ *  A reader increments the acquired count with a single atomic operation and owns one reference of the shared count
+ *  from then on: the acquired count is transferred into the shared count when the pointer is replaced, or folded
+ *  into it before overflowing. Readers never decrement the packed state, so a pointer that gets replaced and then
+ *  stored again can't be confused with its previous publication.
+ *  While published, the shared count holds a large bias preventing readers that drop their reference before the
+ *  transfer from destroying the data, thus 'referenceCount' of a published pointer includes 'PublicationBias'.
+ *  'load' and 'borrow' cost one read-modify-write on the packed state, dropping the result costs one on the shared count. */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class alignas_eighth_cacheline kF::Core::AtomicSharedPtr
+{
+public:
+    static_assert(sizeof(void *) == sizeof(std::uint64_t), "AtomicSharedPtr: Implementation requires 64 bit pointers");
+
+    /** @brief Shared pointer type */
+    using Pointer = SharedPtr<Type, Allocator>;
+
+    /** @brief Shared data type */
+    using Data = typename Pointer::Data;
+
+    /** @brief Packed state layout: data pointer in the low bits, acquired reference count in the high bits */
+    static constexpr std::uint64_t LocalShift = 48u;
+    static constexpr std::uint64_t LocalOne = 1ull << LocalShift;
+    static constexpr std::uint64_t PointerMask = LocalOne - 1u;
+
+    /** @brief Acquired count from which readers fold it into the shared count */
+    static constexpr std::uint64_t FoldThreshold = 1ull << 15u;
+
+    /** @brief Bias added to the shared count of each publication of a pointer, greater than any unfolded acquired count
+     *  The same data may be published by up to 255 atomic shared pointers at once */
+    static constexpr std::uint32_t PublicationBias = 1u << 24u;
+
+
+    /** @brief Scoped reference to the pointer held when the borrow was made
+     *  The borrowed data stays alive until the borrow is destroyed, even if the pointer is replaced meanwhile */
+    class Borrow
+    {
+    public:
+        /** @brief Destructor */
+        inline ~Borrow(void) noexcept { [[maybe_unused]] const Pointer reference(_data); }
+
+        /** @brief Borrow constructor */
+        inline Borrow(const AtomicSharedPtr &atomic) noexcept : _data(atomic.acquire()) {}
+
+
+        /** @brief Boolean check operator */
+        [[nodiscard]] explicit inline operator bool(void) const noexcept { return _data != nullptr; }
+
+
+        /** @brief Borrowed object getter */
+        [[nodiscard]] inline Type *get(void) const noexcept { return &_data->value; }
+
+        /** @brief Borrowed object pointer access */
+        [[nodiscard]] inline Type *operator->(void) const noexcept { return &_data->value; }
+
+        /** @brief Borrowed object reference access */
+        [[nodiscard]] inline Type &operator*(void) const noexcept { return _data->value; }
+
+    private:
+        Data *_data {};
+
+        /** @brief Copy and move constructors disabled */
+        Borrow(const Borrow &other) = delete;
+        Borrow(Borrow &&other) = delete;
+    };
+
+
+    /** @brief Destructor */
+    inline ~AtomicSharedPtr(void) noexcept { [[maybe_unused]] const auto last = Retire(_state.load(std::memory_order_acquire)); }
+
+    /** @brief Default constructor */
+    inline AtomicSharedPtr(void) noexcept = default;
+
+    /** @brief Pointer constructor */
+    inline AtomicSharedPtr(Pointer &&pointer) noexcept : _state(Publish(Detach(pointer))) {}
+
+
+    /** @brief Load the current pointer, never blocks */
+    [[nodiscard]] inline Pointer load(void) const noexcept { return Pointer(acquire()); }
+
+    /** @brief Borrow the current pointer for the lifetime of the returned object, never blocks */
+    [[nodiscard]] inline Borrow borrow(void) const noexcept { return Borrow(*this); }
+
+    /** @brief Replace the current pointer */
+    inline void store(Pointer desired) noexcept { [[maybe_unused]] const auto previous = exchange(std::move(desired)); }
+
+    /** @brief Replace the current pointer and return the previous one */
+    [[nodiscard]] Pointer exchange(Pointer desired) noexcept;
+
+    /** @brief Replace the current pointer if it is equal to 'expected'
+     *  On failure, 'expected' is set to the current pointer and 'desired' is left untouched */
+    [[nodiscard]] bool compareExchange(Pointer &expected, Pointer &&desired) noexcept;
+
+private:
+    mutable std::atomic<std::uint64_t> _state {};
+
+    /** @brief Acquire a reference of the current data, folding the acquired count if it grew too much */
+    [[nodiscard]] Data *acquire(void) const noexcept;
+
+    /** @brief Add the publication bias to the reference owned on 'data' and pack it into a state */
+    [[nodiscard]] static inline std::uint64_t Publish(Data * const data) noexcept
+    {
+        const auto value = reinterpret_cast<std::uint64_t>(data);
+        kFAssert(!(value & ~PointerMask), "AtomicSharedPtr::Publish: Pointer doesn't fit 48 bits");
+        if (data)
+            data->count.fetch_add(PublicationBias - 1u, std::memory_order_relaxed);
+        return value;
+    }
+
+    /** @brief Unpack the data pointer of a state */
+    [[nodiscard]] static inline Data *Unpack(const std::uint64_t state) noexcept
+        { return reinterpret_cast<Data *>(state & PointerMask); }
+
+    /** @brief Take the reference owned by a pointer */
+    [[nodiscard]] static inline Data *Detach(Pointer &pointer) noexcept
+        { const auto data = pointer._ptr; pointer._ptr = nullptr; return data; }
+
+    /** @brief Take the reference owned by a replaced state, transferring its acquired count and removing the publication bias */
+    [[nodiscard]] static inline Pointer Retire(const std::uint64_t state) noexcept
+    {
+        const auto data = Unpack(state);
+        if (data) {
+            const auto acquired = static_cast<std::uint32_t>(state >> LocalShift);
+            data->count.fetch_add(acquired + 1u - PublicationBias, std::memory_order_acq_rel);
+        }
+        return Pointer(data);
+    }
+
+    /** @brief Copy and move constructors disabled */
+    AtomicSharedPtr(const AtomicSharedPtr &other) = delete;
+    AtomicSharedPtr(AtomicSharedPtr &&other) = delete;
+};
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline typename kF::Core::AtomicSharedPtr<Type, Allocator>::Data *kF::Core::AtomicSharedPtr<Type, Allocator>::acquire(void) const noexcept
+{
+    auto state = _state.fetch_add(LocalOne, std::memory_order_acquire) + LocalOne;
+    const auto data = Unpack(state);
+
+    kFAssert(state >> LocalShift, "AtomicSharedPtr::acquire: Acquired reference count overflow");
+    // Fold the acquired count into the shared count, the whole state is compared so the folded value is exact
+    // The count is transferred before resetting the state so that a concurrent retirement can't see it missing
+    if ((state >> LocalShift) >= FoldThreshold) [[unlikely]] {
+        // Null states don't own any reference
+        if (!data) {
+            _state.compare_exchange_strong(state, 0u, std::memory_order_relaxed, std::memory_order_relaxed);
+            return data;
+        }
+        const auto acquired = static_cast<std::uint32_t>(state >> LocalShift);
+        data->count.fetch_add(acquired, std::memory_order_relaxed);
+        if (!_state.compare_exchange_strong(state, state & PointerMask, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            // Another reader folded or a writer retired the state, our own reference keeps the data alive
+            data->count.fetch_sub(acquired - 1u, std::memory_order_relaxed);
+            [[maybe_unused]] const Pointer overcount(data);
+        }
+    }
+    return data;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline typename kF::Core::AtomicSharedPtr<Type, Allocator>::Pointer kF::Core::AtomicSharedPtr<Type, Allocator>::exchange(Pointer desired) noexcept
+{
+    const auto previous = _state.exchange(Publish(Detach(desired)), std::memory_order_acq_rel);
+    return Retire(previous);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::AtomicSharedPtr<Type, Allocator>::compareExchange(Pointer &expected, Pointer &&desired) noexcept
+{
+    // The bias must be set before publishing, readers may drop their reference right after
+    const auto desiredState = Publish(desired._ptr);
+    auto current = _state.load(std::memory_order_relaxed);
+
+    while (Unpack(current) == expected._ptr) {
+        if (_state.compare_exchange_weak(current, desiredState, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            desired._ptr = nullptr;
+            [[maybe_unused]] const auto previous = Retire(current);
+            return true;
+        }
+    }
+    if (desired._ptr)
+        desired._ptr->count.fetch_sub(PublicationBias - 1u, std::memory_order_relaxed);
+    expected = load();
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of BroadcastQueue class
+ */
+
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/BroadcastQueue.hpp>
+
+using namespace kF;
+
+#define GENERATE_TESTS(TEST) \
+    TEST(BusySpin, 1, 1); \
+    TEST(BusySpin, 1, 64); \
+    TEST(BusySpin, 4, 64); \
+    TEST(Yield, 1, 64); \
+    TEST(Yield, 4, 64); \
+    TEST(Futex, 1, 64); \
+    TEST(Futex, 4, 64)
+
+#define BROADCASTQUEUE_THROUGHPUT(Strategy, ConsumerCount, Batch) \
+static void BroadcastQueue_Throughput_##Strategy##_##ConsumerCount##_##Batch(benchmark::State &state) \
+{ \
+    constexpr auto Capacity = 4096ul; \
+    constexpr auto Counter = 1048576ul; \
+    for (auto _ : state) { \
+        Core::BroadcastQueue<std::size_t, Core::Strategy##WaitStrategy> queue(Capacity, ConsumerCount); \
+        std::vector<std::thread> thds; \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        for (auto i = 0ul; i < ConsumerCount; ++i) { \
+            thds.emplace_back([&queue, i] { \
+                std::size_t count = 0, sum = 0; \
+                while (count != Counter) { \
+                    benchmark::DoNotOptimize(queue.waitAvailable(i)); \
+                    count += queue.consume(i, [&sum](const std::size_t value) { sum += value; }); \
+                } \
+                benchmark::DoNotOptimize(sum); \
+            }); \
+        } \
+        for (auto i = 0ul; i < Counter; i += Batch) { \
+            const auto sequence = queue.claim(Batch); \
+            for (auto j = 0ul; j < Batch; ++j) \
+                queue.at(sequence + j) = i + j; \
+            queue.publish(); \
+        } \
+        for (auto &thd : thds) \
+            thd.join(); \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        auto iterationTime = elapsed.count(); \
+        state.SetIterationTime(iterationTime); \
+    } \
+    state.SetItemsProcessed(state.iterations() * Counter); \
+} \
+BENCHMARK(BroadcastQueue_Throughput_##Strategy##_##ConsumerCount##_##Batch)->UseManualTime();
+
+GENERATE_TESTS(BROADCASTQUEUE_THROUGHPUT);
\ No newline at end of file
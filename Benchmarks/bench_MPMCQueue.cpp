@@ -17,6 +17,10 @@ using Queue = Core::MPMCQueue<std::size_t>;
 #define GENERATE_TESTS(TEST, ...) \
     TEST(4096 __VA_OPT__(,) __VA_ARGS__)
 
+#define GENERATE_RANGE_TESTS(TEST, ...) \
+    TEST(4096, 16 __VA_OPT__(,) __VA_ARGS__); \
+    TEST(4096, 128 __VA_OPT__(,) __VA_ARGS__)
+
 #define GENERATE_TESTS_THREADS(TEST) \
     GENERATE_TESTS(TEST, 1, 1); \
     GENERATE_TESTS(TEST, 2, 2); \
@@ -126,3 +130,88 @@ static void MPMCQueue_NoisyPop_##Capacity##_##PushCount##_##PopCount(benchmark::
 BENCHMARK(MPMCQueue_NoisyPop_##Capacity##_##PushCount##_##PopCount)->UseManualTime();
 
 GENERATE_TESTS_THREADS(MPMCQUEUE_NOISY_POP);
+
+
+#define MPMCQUEUE_RANGEPUSH(Capacity, Div) \
+static void MPMCQueue_RangePush_##Capacity##_##Div(benchmark::State &state) \
+{ \
+    Queue queue(Capacity); \
+    std::size_t cache[Capacity / Div]; \
+    for (auto &c : cache) \
+        c = 42ul; \
+    for (auto _ : state) { \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        if (!queue.tryPushRange(cache, cache + Capacity / Div)) \
+            return; \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        auto iterationTime = elapsed.count(); \
+        state.SetIterationTime(iterationTime); \
+        if (!queue.tryPopRange(cache, cache + Capacity / Div)) \
+            return; \
+    } \
+} \
+BENCHMARK(MPMCQueue_RangePush_##Capacity##_##Div)->UseManualTime();
+
+GENERATE_RANGE_TESTS(MPMCQUEUE_RANGEPUSH);
+
+#define MPMCQUEUE_RANGEPOP(Capacity, Div) \
+static void MPMCQueue_RangePop_##Capacity##_##Div(benchmark::State &state) \
+{ \
+    Queue queue(Capacity); \
+    std::size_t cache[Capacity / Div]; \
+    for (auto &c : cache) \
+        c = 42ul; \
+    for (auto _ : state) { \
+        if (!queue.tryPushRange(cache, cache + Capacity / Div)) \
+            return; \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        if (!queue.tryPopRange(cache, cache + Capacity / Div)) \
+            return; \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        auto iterationTime = elapsed.count(); \
+        state.SetIterationTime(iterationTime); \
+    } \
+} \
+BENCHMARK(MPMCQueue_RangePop_##Capacity##_##Div)->UseManualTime();
+
+GENERATE_RANGE_TESTS(MPMCQUEUE_RANGEPOP);
+
+#define GENERATE_LAYOUT_TESTS(TEST) \
+    TEST(Packed, 8); \
+    TEST(Packed, 16); \
+    TEST(Packed, 32); \
+    TEST(Padded, 8); \
+    TEST(Padded, 16); \
+    TEST(Padded, 32); \
+    TEST(Remapped, 8); \
+    TEST(Remapped, 16); \
+    TEST(Remapped, 32)
+
+#define MPMCQUEUE_LAYOUT_THROUGHPUT(Layout, ThreadCount) \
+static void MPMCQueue_LayoutThroughput_##Layout##_##ThreadCount(benchmark::State &state) \
+{ \
+    constexpr auto Capacity = 4096ul; \
+    constexpr auto Counter = 65536ul; \
+    Core::MPMCQueue<std::size_t, Core::DefaultStaticAllocator, Core::MPMCQueueLayout::Layout> queue(Capacity); \
+    for (auto _ : state) { \
+        std::atomic<std::size_t> popCount { 0 }; \
+        std::vector<std::thread> thds; \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        for (auto i = 0ul; i < ThreadCount / 2; ++i) { \
+            thds.emplace_back([&queue] { for (auto j = 0ul; j < Counter / (ThreadCount / 2);) j += queue.push(j); }); \
+            thds.emplace_back([&queue, &popCount] { std::size_t tmp; while (popCount < Counter) popCount += queue.pop(tmp); }); \
+        } \
+        for (auto &thd : thds) \
+            thd.join(); \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        auto iterationTime = elapsed.count(); \
+        state.SetIterationTime(iterationTime); \
+    } \
+    state.SetItemsProcessed(state.iterations() * Counter); \
+} \
+BENCHMARK(MPMCQueue_LayoutThroughput_##Layout##_##ThreadCount)->UseManualTime();
+
+GENERATE_LAYOUT_TESTS(MPMCQUEUE_LAYOUT_THROUGHPUT);
\ No newline at end of file
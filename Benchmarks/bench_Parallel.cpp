@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of parallel algorithms
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Parallel.hpp>
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+using Vector = Core::LongVector<std::size_t>;
+
+#define GENERATE_TESTS(TEST) \
+    TEST(1000000); \
+    TEST(10000000)
+
+static Vector MakeRandomVector(const std::size_t count) noexcept
+{
+    std::mt19937_64 generator(42);
+    Vector vector(count);
+
+    for (auto &value : vector)
+        value = generator();
+    return vector;
+}
+
+#define PARALLEL_SORT(Count) \
+static void Parallel_Sort_##Count(benchmark::State &state) \
+{ \
+    const auto source = MakeRandomVector(Count); \
+    for (auto _ : state) { \
+        state.PauseTiming(); \
+        auto vector = source; \
+        state.ResumeTiming(); \
+        Core::ParallelSort(vector.toRange()); \
+        benchmark::DoNotOptimize(vector.data()); \
+    } \
+} \
+BENCHMARK(Parallel_Sort_##Count)->Unit(benchmark::kMillisecond);
+
+GENERATE_TESTS(PARALLEL_SORT);
+
+#define STD_SORT(Count) \
+static void Std_Sort_##Count(benchmark::State &state) \
+{ \
+    const auto source = MakeRandomVector(Count); \
+    for (auto _ : state) { \
+        state.PauseTiming(); \
+        auto vector = source; \
+        state.ResumeTiming(); \
+        std::sort(vector.begin(), vector.end()); \
+        benchmark::DoNotOptimize(vector.data()); \
+    } \
+} \
+BENCHMARK(Std_Sort_##Count)->Unit(benchmark::kMillisecond);
+
+GENERATE_TESTS(STD_SORT);
+
+#define PARALLEL_REDUCE(Count) \
+static void Parallel_Reduce_##Count(benchmark::State &state) \
+{ \
+    const auto vector = MakeRandomVector(Count); \
+    for (auto _ : state) \
+        benchmark::DoNotOptimize(Core::ParallelReduce(vector.toRange(), 0ul, std::plus<> {})); \
+} \
+BENCHMARK(Parallel_Reduce_##Count)->Unit(benchmark::kMillisecond);
+
+GENERATE_TESTS(PARALLEL_REDUCE);
+
+#define PARALLEL_FOR(Count) \
+static void Parallel_For_##Count(benchmark::State &state) \
+{ \
+    auto vector = MakeRandomVector(Count); \
+    for (auto _ : state) { \
+        Core::ParallelFor(vector.toRange(), [](std::size_t &value) { value = value * 6364136223846793005ul + 1442695040888963407ul; }); \
+        benchmark::DoNotOptimize(vector.data()); \
+    } \
+} \
+BENCHMARK(Parallel_For_##Count)->Unit(benchmark::kMillisecond);
+
+GENERATE_TESTS(PARALLEL_FOR);
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Broadcast Queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+#include "HeapArray.hpp"
+#include "WaitStrategy.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+    class BroadcastQueue;
+}
+
+/**
+ * @brief The broadcast queue is a lock-free ring buffer with a Single Producer and Multiple Consumers where
+ * every consumer sees every element (disruptor pattern)
+ * Each consumer owns a sequence, the producer is gated by the slowest consumer.
+ * Elements are default constructed once and reused, the producer writes them in place and consumers read them in place.
+ * Elements can be claimed / published and consumed by batches.
+ *
+ * @tparam Type to be inserted
+ * @tparam WaitStrategy Strategy used by blocking operations
+ * @tparam Allocator Static allocator
+ */
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy = kF::Core::BusySpinWaitStrategy,
+        kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class alignas_double_cacheline kF::Core::BroadcastQueue
+{
+public:
+    static_assert(std::is_default_constructible_v<Type>, "Core::BroadcastQueue: Type must be default constructible");
+
+    /** @brief Sequence of a consumer */
+    struct alignas_cacheline Consumer
+    {
+        std::atomic<std::size_t> sequence { 0 };
+    };
+
+    /** @brief Buffer structure containing all cells */
+    struct Buffer
+    {
+        Type *data {};
+        std::size_t mask { 0 };
+    };
+
+    /** @brief Cache of the producer */
+    struct Cache
+    {
+        std::size_t claimed { 0 }; // Claimed sequence
+        std::size_t gating { 0 }; // Last known sequence of the slowest consumer
+    };
+
+
+    /** @brief Destruct and release all memory */
+    ~BroadcastQueue(void) noexcept;
+
+    /** @brief Construct the queue, 'capacity' must be a power of 2 */
+    BroadcastQueue(const std::size_t capacity, const std::size_t consumerCount) noexcept;
+
+
+    /** @brief Claim 'count' elements
+     *  @return true if the elements have been claimed, their sequences start at 'sequence' */
+    [[nodiscard]] bool tryClaim(const std::size_t count, std::size_t &sequence) noexcept;
+
+    /** @brief Claim 'count' elements, waiting for the slowest consumer if needed
+     *  @return Sequence of the first claimed element */
+    [[nodiscard]] std::size_t claim(const std::size_t count) noexcept;
+
+    /** @brief Publish every claimed element */
+    void publish(void) noexcept;
+
+    /** @brief Get the element at a given sequence */
+    [[nodiscard]] inline Type &at(const std::size_t sequence) noexcept { return _buffer.data[sequence & _buffer.mask]; }
+    [[nodiscard]] inline const Type &at(const std::size_t sequence) const noexcept { return _buffer.data[sequence & _buffer.mask]; }
+
+
+    /** @brief Push a single element
+     *  @return true if the element has been inserted */
+    template<typename ...Args>
+    [[nodiscard]] bool tryPush(Args &&...args) noexcept;
+
+    /** @brief Push a single element, waiting for the slowest consumer if needed */
+    template<typename ...Args>
+    void push(Args &&...args) noexcept;
+
+
+    /** @brief Get the number of published elements not yet consumed by a consumer */
+    [[nodiscard]] std::size_t available(const std::size_t consumer) const noexcept;
+
+    /** @brief Wait until a consumer has at least one element available
+     *  @return The number of available elements */
+    [[nodiscard]] std::size_t waitAvailable(const std::size_t consumer) noexcept;
+
+    /** @brief Invoke 'callable(const Type &)' over up to 'maxCount' available elements of a consumer
+     *  The consumer sequence is only updated once for the whole batch
+     *  @return The number of consumed elements */
+    template<typename Callable>
+    std::size_t consume(const std::size_t consumer, Callable &&callable, const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept;
+
+    /** @brief Copy a single element to a consumer
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool tryPop(const std::size_t consumer, Type &value) noexcept;
+
+
+    /** @brief Get the capacity of the queue */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return _buffer.mask + 1; }
+
+    /** @brief Get the number of consumers */
+    [[nodiscard]] inline std::size_t consumerCount(void) const noexcept { return _consumers.size(); }
+
+
+private:
+    alignas_cacheline std::atomic<std::size_t> _cursor { 0 }; // Published sequence accessed by producer and consumers
+    alignas_cacheline Cache _cache {}; // Cache accessed by producer
+    alignas_cacheline Buffer _buffer {}; // Buffer is constant after construction
+    HeapArray<Consumer, Allocator, std::size_t> _consumers {}; // Consumer sequences
+
+
+    /** @brief Copy and move constructors disabled */
+    BroadcastQueue(const BroadcastQueue &other) = delete;
+    BroadcastQueue(BroadcastQueue &&other) = delete;
+
+
+    /** @brief Refresh the gating sequence and get the slowest consumer */
+    Consumer &refreshGating(void) noexcept;
+};
+
+#include "BroadcastQueue.ipp"
\ No newline at end of file
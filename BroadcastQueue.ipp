@@ -0,0 +1,149 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Broadcast Queue
+ */
+
+#include "Abort.hpp"
+#include "Assert.hpp"
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::~BroadcastQueue(void) noexcept
+{
+    std::destroy_n(_buffer.data, capacity());
+    Allocator::Deallocate(_buffer.data, sizeof(Type) * capacity(), alignof(Type));
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::BroadcastQueue(const std::size_t capacity, const std::size_t consumerCount) noexcept
+    : _consumers(consumerCount)
+{
+    kFEnsure((capacity >= 2) && (capacity & (capacity - 1ul)) == 0, // Ensure capacity is  a power of two >= 2
+        "Core::BroadcastQueue: Buffer capacity must be a power of 2 (", capacity, ')');
+    kFEnsure(consumerCount, "Core::BroadcastQueue: Queue must have at least one consumer");
+    _buffer.mask = capacity - 1;
+    _buffer.data = reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * capacity, alignof(Type)));
+    kFEnsure(_buffer.data, // Ensure allocation succeed
+        "Core::BroadcastQueue: Allocation of capacity ", capacity, " failed");
+    std::uninitialized_value_construct_n(_buffer.data, capacity);
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::tryClaim(const std::size_t count, std::size_t &sequence) noexcept
+{
+    const auto claimed = _cache.claimed;
+    const auto next = claimed + count;
+
+    kFAssert(count <= capacity(), "Core::BroadcastQueue::tryClaim: Claim count exceed capacity");
+    if (next - _cache.gating > capacity()) [[unlikely]] {
+        refreshGating();
+        if (next - _cache.gating > capacity()) [[unlikely]]
+            return false;
+    }
+    _cache.claimed = next;
+    sequence = claimed;
+    return true;
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::claim(const std::size_t count) noexcept
+{
+    const auto claimed = _cache.claimed;
+    const auto next = claimed + count;
+
+    kFAssert(count <= capacity(), "Core::BroadcastQueue::claim: Claim count exceed capacity");
+    while (next - _cache.gating > capacity()) [[unlikely]] {
+        auto &slowest = refreshGating();
+        if (next - _cache.gating > capacity())
+            WaitStrategy::Wait(slowest.sequence, _cache.gating);
+    }
+    _cache.claimed = next;
+    return claimed;
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::publish(void) noexcept
+{
+    _cursor.store(_cache.claimed, std::memory_order_release);
+    WaitStrategy::Notify(_cursor);
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ...Args>
+inline bool kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::tryPush(Args &&...args) noexcept
+{
+    std::size_t sequence;
+
+    if (!tryClaim(1, sequence)) [[unlikely]]
+        return false;
+    at(sequence) = Type(std::forward<Args>(args)...);
+    publish();
+    return true;
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ...Args>
+inline void kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::push(Args &&...args) noexcept
+{
+    at(claim(1)) = Type(std::forward<Args>(args)...);
+    publish();
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::available(const std::size_t consumer) const noexcept
+{
+    return _cursor.load(std::memory_order_acquire) - _consumers[consumer].sequence.load(std::memory_order_relaxed);
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::waitAvailable(const std::size_t consumer) noexcept
+{
+    const auto sequence = _consumers[consumer].sequence.load(std::memory_order_relaxed);
+
+    while (true) {
+        const auto cursor = _cursor.load(std::memory_order_acquire);
+        if (cursor != sequence) [[likely]]
+            return cursor - sequence;
+        WaitStrategy::Wait(_cursor, cursor);
+    }
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callable>
+inline std::size_t kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::consume(const std::size_t consumer, Callable &&callable, const std::size_t maxCount) noexcept
+{
+    auto &sequence = _consumers[consumer].sequence;
+    const auto from = sequence.load(std::memory_order_relaxed);
+    const auto count = std::min(_cursor.load(std::memory_order_acquire) - from, maxCount);
+
+    for (auto i = 0ul; i != count; ++i)
+        callable(std::as_const(at(from + i)));
+    if (count) {
+        sequence.store(from + count, std::memory_order_release);
+        WaitStrategy::Notify(sequence);
+    }
+    return count;
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::tryPop(const std::size_t consumer, Type &value) noexcept
+{
+    return consume(consumer, [&value](const Type &elem) { value = elem; }, 1ul);
+}
+
+template<typename Type, kF::Core::WaitStrategyRequirements WaitStrategy, kF::Core::StaticAllocatorRequirements Allocator>
+inline typename kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::Consumer &
+    kF::Core::BroadcastQueue<Type, WaitStrategy, Allocator>::refreshGating(void) noexcept
+{
+    auto *slowest = &_consumers[0];
+    auto gating = slowest->sequence.load(std::memory_order_acquire);
+
+    for (auto &consumer : _consumers) {
+        const auto sequence = consumer.sequence.load(std::memory_order_acquire);
+        if (sequence < gating) {
+            gating = sequence;
+            slowest = &consumer;
+        }
+    }
+    _cache.gating = gating;
+    return *slowest;
+}
\ No newline at end of file
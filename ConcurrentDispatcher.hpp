@@ -0,0 +1,20 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Concurrent Dispatcher
+ */
+
+#pragma once
+
+#include "Functor.hpp"
+#include "ConcurrentDispatcherDetails.hpp"
+
+namespace kF::Core
+{
+    /** @brief Specialization of concurrent dispatcher with 'Functor' */
+    template<
+        typename Signature,
+        StaticAllocatorRequirements Allocator = DefaultStaticAllocator,
+        std::size_t DesiredSize = CacheLineHalfSize
+    >
+    using ConcurrentDispatcher = ConcurrentDispatcherDetails<Signature, Functor<Signature, Allocator, DesiredSize>, Allocator>;
+}
\ No newline at end of file
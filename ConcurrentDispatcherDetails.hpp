@@ -0,0 +1,220 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Concurrent Dispatcher
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Assert.hpp"
+#include "FunctorUtils.hpp"
+#include "Vector.hpp"
+#include "AtomicSharedPtr.hpp"
+#include "DispatcherSlot.hpp"
+
+namespace kF::Core
+{
+    template<typename Signature, FunctorRequirements InternalFunctor, StaticAllocatorRequirements Allocator>
+    class ConcurrentDispatcherDetails;
+}
+
+/**
+ * @brief Thread-safe event dispatcher with removable slots
+ * Dispatch reads an immutable snapshot of the slot list and never locks nor waits.
+ * Adding or removing a slot copies the current snapshot and publishes the new one with a CAS,
+ * the replaced snapshot is released by its last reader.
+ * Snapshots are held by an AtomicSharedPtr, dispatch borrows the current one without touching its shared count.
+ * Slots may be added or removed from any thread, including from a dispatched functor.
+ * Functors sharing the same invoke function are dispatched in a row, thus dispatch order is not insertion order.
+ */
+template<typename Return, typename... Args, kF::Core::FunctorRequirements InternalFunctor, kF::Core::StaticAllocatorRequirements Allocator>
+class alignas_eighth_cacheline kF::Core::ConcurrentDispatcherDetails<Return(Args...), InternalFunctor, Allocator>
+{
+public:
+    /** @brief Functor type */
+    using Functor = InternalFunctor;
+
+    /** @brief Functor handle */
+    using Handle = DispatcherSlot::Handle;
+
+    /** @brief Shared slot, reused across snapshots */
+    struct Slot
+    {
+        InternalFunctor functor {};
+        Handle handle {};
+    };
+
+    /** @brief Shared slot pointer */
+    using SlotPtr = SharedPtr<Slot, Allocator>;
+
+    /** @brief Immutable list of slots */
+    struct Snapshot
+    {
+        Vector<SlotPtr, Allocator> slots {};
+    };
+
+    /** @brief Shared snapshot pointer */
+    using SnapshotPtr = SharedPtr<Snapshot, Allocator>;
+
+    /** @brief Concurrent dispatcher instance */
+    struct alignas_cacheline Instance
+    {
+        AtomicSharedPtr<Snapshot, Allocator> snapshot { SnapshotPtr::Make() };
+        std::atomic<Handle> lastHandle {};
+
+
+        /** @brief Copy the current snapshot using 'update(from, to)' and publish the result
+         *  If another writer published first, the update is computed again */
+        template<typename Update>
+        inline void update(Update &&update) noexcept
+        {
+            auto current = snapshot.load();
+            while (true) {
+                auto next = SnapshotPtr::Make();
+                update(current->slots, next->slots);
+                if (snapshot.compareExchange(current, std::move(next)))
+                    return;
+            }
+        }
+
+        /** @brief Insert a slot at the end of its invoke group */
+        inline void insert(SlotPtr &&slot) noexcept
+        {
+            update([&slot](const auto &from, auto &to) {
+                const auto invoker = slot->functor.invoker();
+                auto position = from.size();
+                for (auto i = from.size(); i; --i) {
+                    if (from[i - 1]->functor.invoker() == invoker) {
+                        position = i;
+                        break;
+                    }
+                }
+                to.reserve(from.size() + 1);
+                for (auto i = 0u; i != position; ++i)
+                    to.push(from[i]);
+                to.push(slot);
+                for (auto i = position; i != from.size(); ++i)
+                    to.push(from[i]);
+            });
+        }
+
+        /** @brief Remove a slot from its handle */
+        inline void remove(const Handle handle) noexcept
+        {
+            kFAssert(handle, "ConcurrentDispatcherDetails::remove: Can't remove null handle");
+            update([handle](const auto &from, auto &to) {
+                to.reserve(from.size());
+                for (const auto &slot : from) {
+                    if (slot->handle != handle)
+                        to.push(slot);
+                }
+            });
+        }
+    };
+
+    /** @brief Shared dispatcher instance */
+    using SharedInstance = SharedPtr<Instance, Allocator>;
+
+
+    /** @brief Destructor */
+    inline ~ConcurrentDispatcherDetails(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline ConcurrentDispatcherDetails(void) noexcept = default;
+
+    /** @brief Move constructor */
+    inline ConcurrentDispatcherDetails(ConcurrentDispatcherDetails &&dispatcher) noexcept = default;
+
+
+    /** @brief Move assignment*/
+    inline ConcurrentDispatcherDetails &operator=(ConcurrentDispatcherDetails &&dispatcher) noexcept = default;
+
+
+    /** @brief Internal functor count */
+    [[nodiscard]] inline auto count(void) const noexcept
+    {
+        return _sharedInstance->snapshot.borrow()->slots.size();
+    }
+
+
+    /** @brief Add a functor to dispatch list */
+    template<typename Functor>
+    [[nodiscard]] inline DispatcherSlot add(Functor &&functor) noexcept
+    {
+        auto slot = SlotPtr::Make();
+        slot->functor.prepare(std::forward<Functor>(functor));
+        return insert(std::move(slot));
+    }
+
+    /** @brief Add a member function to dispatch list */
+    template<auto MemberFunction, typename ClassType>
+    [[nodiscard]] inline DispatcherSlot add(ClassType &&classType) noexcept
+    {
+        auto slot = SlotPtr::Make();
+        slot->functor.template prepare<MemberFunction>(std::forward<ClassType>(classType));
+        return insert(std::move(slot));
+    }
+
+    /** @brief Add a free function to dispatch list */
+    template<auto FreeFunction>
+    [[nodiscard]] inline DispatcherSlot add(void) noexcept
+    {
+        auto slot = SlotPtr::Make();
+        slot->functor.template prepare<FreeFunction>();
+        return insert(std::move(slot));
+    }
+
+
+    /** @brief Dispatch every internal functors */
+    inline void dispatch(Args ...args) const noexcept
+    {
+        const auto snapshot = _sharedInstance->snapshot.borrow();
+        for (const auto &slot : snapshot->slots)
+            slot->functor(std::forward<Args>(args)...);
+    }
+
+    /** @brief Dispatch every internal functors with a given callback to receive the return value of each functor */
+    template<typename Callback>
+        requires (!std::is_same_v<Return, void> && std::invocable<Callback, Return>)
+    inline void dispatch(Callback &&callback, Args ...args) const noexcept
+    {
+        const auto snapshot = _sharedInstance->snapshot.borrow();
+        for (const auto &slot : snapshot->slots)
+            callback(slot->functor(std::forward<Args>(args)...));
+    }
+
+private:
+    /** @brief Publish a prepared slot and construct its dispatcher slot */
+    [[nodiscard]] inline DispatcherSlot insert(SlotPtr &&slot) noexcept
+    {
+        auto &instance = *_sharedInstance;
+        const auto handle = instance.lastHandle.fetch_add(1u, std::memory_order_relaxed) + 1u;
+        slot->handle = handle;
+        instance.insert(std::move(slot));
+        return makeDispatcherSlot(handle);
+    }
+
+    /** @brief Construct a dispatcher from an handle */
+    [[nodiscard]] inline DispatcherSlot makeDispatcherSlot(const Handle handle) noexcept
+    {
+        constexpr auto DisconnectFunc = [](void *data, const Handle handle) {
+            auto &sharedInstance = *reinterpret_cast<SharedInstance *>(&data);
+            // Remove slot
+            sharedInstance->remove(handle);
+            // Decrement reference count
+            sharedInstance.release();
+        };
+
+        // Increment reference count
+        static_assert(sizeof(SharedInstance) == sizeof(void*), "ConcurrentDispatcherDetails: Implementation requires SharedPtr 8 byte sized");
+        void *data {};
+        new (&data) SharedInstance(_sharedInstance);
+
+        // Construct dispatcher slot
+        return DispatcherSlot::Make(DisconnectFunc, data, handle);
+    }
+
+
+    SharedInstance _sharedInstance { SharedInstance::Make() };
+};
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "FunctorUtils.hpp"
 #include "Vector.hpp"
+#include "DispatcherGroups.hpp"
 
 namespace kF::Core
 {
@@ -14,7 +15,8 @@ namespace kF::Core
     class DispatcherDetails;
 }
 
-/** @brief Fast event dispatcher */
+/** @brief Fast event dispatcher
+ *  Functors are grouped by invoke function, thus dispatch order is not insertion order */
 template<typename Return, typename... Args, kF::Core::FunctorRequirements InternalFunctor, kF::Core::StaticAllocatorRequirements Allocator>
 class alignas_quarter_cacheline kF::Core::DispatcherDetails<Return(Args...), InternalFunctor, Allocator>
 {
@@ -22,6 +24,9 @@ public:
     /** @brief Functor type */
     using Functor = InternalFunctor;
 
+    /** @brief Functor groups */
+    using Groups = Internal::DispatcherGroups<decltype(std::declval<const InternalFunctor &>().invoker()), Allocator>;
+
     /** @brief Destructor */
     inline ~DispatcherDetails(void) noexcept = default;
 
@@ -42,26 +47,45 @@ public:
 
     /** @brief Add a functor to dispatch list */
     template<typename Functor>
-    inline void add(Functor &&functor) noexcept { _functors.push().prepare(std::forward<Functor>(functor)); }
+    inline void add(Functor &&functor) noexcept
+    {
+        InternalFunctor internal;
+        internal.prepare(std::forward<Functor>(functor));
+        insert(std::move(internal));
+    }
 
     /** @brief Add a member function to dispatch list */
     template<auto MemberFunction, typename ClassType>
-    inline void add(ClassType &&instance) noexcept { _functors.push().template prepare<MemberFunction>(std::forward<ClassType>(instance)); }
+    inline void add(ClassType &&instance) noexcept
+    {
+        InternalFunctor internal;
+        internal.template prepare<MemberFunction>(std::forward<ClassType>(instance));
+        insert(std::move(internal));
+    }
 
     /** @brief Add a free function to dispatch list */
     template<auto FreeFunction>
-    inline void add(void) noexcept { _functors.push().template prepare<FreeFunction>(); }
+    inline void add(void) noexcept
+    {
+        InternalFunctor internal;
+        internal.template prepare<FreeFunction>();
+        insert(std::move(internal));
+    }
 
 
     /** @brief Clear dispatch list */
-    inline void clear(void) noexcept { _functors.clear(); }
+    inline void clear(void) noexcept { _functors.clear(); _groups.clear(); }
 
 
     /** @brief Dispatch every internal functors */
     inline void dispatch(Args ...args) const noexcept
     {
-        for (auto &functor : _functors)
-            functor(std::forward<Args>(args)...);
+        const auto functors = _functors.begin();
+        for (const auto &group : _groups) {
+            const auto invoke = group.key;
+            for (auto i = group.begin; i != group.end; ++i)
+                functors[i].invokeWith(invoke, std::forward<Args>(args)...);
+        }
     }
 
     /** @brief Dispatch every internal functors with a given callback to receive the return value of each functor */
@@ -69,10 +93,26 @@ public:
         requires (!std::is_same_v<Return, void> && std::invocable<Callback, Return>)
     inline void dispatch(Callback &&callback, Args ...args) const noexcept
     {
-        for (auto &functor : _functors)
-            callback(functor(std::forward<Args>(args)...));
+        const auto functors = _functors.begin();
+        for (const auto &group : _groups) {
+            const auto invoke = group.key;
+            for (auto i = group.begin; i != group.end; ++i)
+                callback(functors[i].invokeWith(invoke, std::forward<Args>(args)...));
+        }
     }
 
 private:
     Vector<InternalFunctor, Allocator> _functors {};
+    Groups _groups {};
+
+
+    /** @brief Insert a prepared functor at the end of its group */
+    inline void insert(InternalFunctor &&functor) noexcept
+    {
+        _functors.push();
+        const auto position = _groups.insert(functor.invoker(), [this](const auto from, const auto to) {
+            _functors[to] = std::move(_functors[from]);
+        });
+        _functors[position] = std::move(functor);
+    }
 };
\ No newline at end of file
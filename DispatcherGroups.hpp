@@ -0,0 +1,70 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Dispatcher Groups
+ */
+
+#pragma once
+
+#include "Vector.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename Key, kF::Core::StaticAllocatorRequirements Allocator>
+    class DispatcherGroups;
+}
+
+/**
+ * @brief Keep the functors of a dispatcher grouped by invoke function
+ * Functors sharing the same invoke function are stored contiguously so they are dispatched in a row,
+ * which keeps the indirect call target stable across each group.
+ * Groups are ordered by creation, dispatch order within a dispatcher is thus not the insertion order.
+ * Inserting or removing a functor costs at most one functor move per group.
+ *
+ * @tparam Key Invoke function type
+ * @tparam Allocator Static allocator
+ */
+template<typename Key, kF::Core::StaticAllocatorRequirements Allocator>
+class kF::Core::Internal::DispatcherGroups
+{
+public:
+    /** @brief Range of functor positions */
+    using Range = std::uint32_t;
+
+    /** @brief Contiguous range of functors sharing the same key */
+    struct Group
+    {
+        Key key {};
+        Range begin {};
+        Range end {};
+    };
+
+
+    /** @brief Get the number of groups */
+    [[nodiscard]] inline Range count(void) const noexcept { return _groups.size(); }
+
+    /** @brief Begin / end iterators over groups */
+    [[nodiscard]] inline const Group *begin(void) const noexcept { return _groups.begin(); }
+    [[nodiscard]] inline const Group *end(void) const noexcept { return _groups.end(); }
+
+
+    /** @brief Reserve the position of a new functor inside its group and return it
+     *  The caller must have appended a free slot at the end of its functor list before calling insert
+     *  'move' is called as 'move(from, to)' to move a functor into a free position */
+    template<typename MoveFunc>
+    [[nodiscard]] Range insert(const Key key, MoveFunc &&move) noexcept;
+
+    /** @brief Remove the functor at 'position' from its group
+     *  After the call, the last slot of the caller's functor list is free and must be removed
+     *  'move' is called as 'move(from, to)' to move a functor into a free position */
+    template<typename MoveFunc>
+    void erase(const Range position, MoveFunc &&move) noexcept;
+
+
+    /** @brief Clear every group */
+    inline void clear(void) noexcept { _groups.clear(); }
+
+private:
+    Vector<Group, Allocator, Range> _groups {};
+};
+
+#include "DispatcherGroups.ipp"
\ No newline at end of file
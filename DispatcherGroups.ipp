@@ -0,0 +1,65 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Dispatcher Groups
+ */
+
+#include <algorithm>
+
+#include "Assert.hpp"
+#include "DispatcherGroups.hpp"
+
+template<typename Key, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename MoveFunc>
+inline typename kF::Core::Internal::DispatcherGroups<Key, Allocator>::Range
+    kF::Core::Internal::DispatcherGroups<Key, Allocator>::insert(const Key key, MoveFunc &&move) noexcept
+{
+    const Range count = _groups.size();
+    Range index = 0;
+
+    while (index != count && _groups[index].key != key)
+        ++index;
+
+    // Create a new group at the end of the list
+    if (index == count) [[unlikely]] {
+        const Range position = count ? _groups.back().end : Range(0);
+        _groups.push(Group { key, position, position + 1 });
+        return position;
+    }
+
+    // Shift every following group by one, moving their first functor after their last one
+    for (auto i = count - 1; i != index; --i) {
+        auto &group = _groups[i];
+        move(group.begin, group.end);
+        ++group.begin;
+        ++group.end;
+    }
+    return _groups[index].end++;
+}
+
+template<typename Key, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename MoveFunc>
+inline void kF::Core::Internal::DispatcherGroups<Key, Allocator>::erase(const Range position, MoveFunc &&move) noexcept
+{
+    auto it = std::upper_bound(_groups.begin(), _groups.end(), position,
+        [](const Range value, const Group &group) { return value < group.begin; }) - 1;
+
+    kFAssert(position >= it->begin && position < it->end,
+        "DispatcherGroups::erase: Position out of range");
+
+    // Fill the hole with the last functor of the group
+    Range hole = --it->end;
+    if (position != hole)
+        move(hole, position);
+
+    // Shift every following group backward by one, moving their last functor before their first one
+    const auto end = _groups.end();
+    for (auto group = it + 1; group != end; ++group) {
+        --group->end;
+        --group->begin;
+        move(group->end, hole);
+        hole = group->end;
+    }
+
+    if (it->begin == it->end)
+        _groups.erase(it);
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Epoch based memory reclamation
+ */
+
+#include "EpochManager.hpp"
+
+using namespace kF;
+
+namespace
+{
+    /** @brief Participant of the shared epoch manager registered implicitly by the current thread, unregistered at thread exit */
+    struct ThreadParticipant
+    {
+        Core::EpochManager::Participant *participant {};
+
+        ~ThreadParticipant(void) noexcept
+        {
+            if (!participant)
+                return;
+            participant->threadOwned = false;
+            participant->manager->unregisterThread(*participant);
+        }
+    };
+
+    thread_local ThreadParticipant LocalParticipant {};
+}
+
+Core::EpochManager &Core::SharedEpochManager(void) noexcept
+{
+    static EpochManager SharedInstance;
+
+    return SharedInstance;
+}
+
+Core::EpochManager::~EpochManager(void) noexcept
+{
+    auto participant = _participants.load(std::memory_order_acquire);
+
+    while (participant) {
+        const auto next = participant->next;
+        kFAssert(!participant->registered.load(std::memory_order_relaxed), "EpochManager::~EpochManager: Participant is still registered");
+        for (auto &limbo : participant->limbos)
+            Release(limbo);
+        participant->~Participant();
+        DefaultStaticAllocator::Deallocate(participant, sizeof(Participant), alignof(Participant));
+        participant = next;
+    }
+}
+
+Core::EpochManager::Participant &Core::EpochManager::registerThread(void) noexcept
+{
+    // Reuse a free record
+    for (auto participant = _participants.load(std::memory_order_acquire); participant; participant = participant->next) {
+        bool expected = false;
+        if (!participant->registered.load(std::memory_order_relaxed)
+                && participant->registered.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+            return *participant;
+    }
+
+    // Publish a new record, records are never unlinked so the list can be walked without protection
+    auto participant = new (DefaultStaticAllocator::Allocate(sizeof(Participant), alignof(Participant))) Participant {};
+    participant->manager = this;
+    participant->registered.store(true, std::memory_order_relaxed);
+    participant->next = _participants.load(std::memory_order_relaxed);
+    while (!_participants.compare_exchange_weak(participant->next, participant, std::memory_order_release, std::memory_order_relaxed));
+    return *participant;
+}
+
+void Core::EpochManager::unregisterThread(Participant &participant) noexcept
+{
+    kFAssert(!participant.depth, "EpochManager::unregisterThread: Participant is inside a critical section");
+    kFAssert(!participant.threadOwned, "EpochManager::unregisterThread: Participant is owned by its thread and unregistered at thread exit");
+    collect(participant);
+    participant.registered.store(false, std::memory_order_release);
+}
+
+Core::EpochManager::Participant &Core::EpochManager::threadParticipant(void) noexcept
+{
+    kFAssert(this == &SharedEpochManager(), "EpochManager::threadParticipant: Only the shared epoch manager supports implicit registration");
+    if (!LocalParticipant.participant) [[unlikely]] {
+        LocalParticipant.participant = &registerThread();
+        LocalParticipant.participant->threadOwned = true;
+    }
+    return *LocalParticipant.participant;
+}
+
+bool Core::EpochManager::tryAdvance(void) noexcept
+{
+    auto epoch = _epoch.load(std::memory_order_seq_cst);
+
+    for (auto participant = _participants.load(std::memory_order_acquire); participant; participant = participant->next) {
+        const auto local = participant->epoch.load(std::memory_order_seq_cst);
+        if (local != InactiveEpoch && local != epoch)
+            return false;
+    }
+    // Another thread may have advanced the epoch concurrently, which is fine as well
+    _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    return true;
+}
+
+void Core::EpochManager::collect(Participant &participant) noexcept
+{
+    participant.retiredCount = 0;
+    tryAdvance();
+    const auto epoch = _epoch.load(std::memory_order_seq_cst);
+    for (auto &limbo : participant.limbos) {
+        if (!limbo.list.empty() && limbo.epoch + 2 <= epoch)
+            Release(limbo);
+    }
+}
+
+std::size_t Core::EpochManager::pendingCount(const Participant &participant) const noexcept
+{
+    std::size_t count = 0;
+
+    for (const auto &limbo : participant.limbos)
+        count += limbo.list.size();
+    return count;
+}
+
+void Core::EpochManager::Release(Limbo &limbo) noexcept
+{
+    // Deleters may retire other nodes, the list is detached while it is being released
+    Vector<Retired> list;
+    list.swap(limbo.list);
+    for (const auto &retired : list)
+        retired.deleter(retired.ptr);
+    list.clear();
+    if (limbo.list.empty())
+        limbo.list.swap(list);
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Epoch based memory reclamation
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    class EpochManager;
+    class EpochGuard;
+
+    /** @brief Get the process-wide epoch manager */
+    [[nodiscard]] EpochManager &SharedEpochManager(void) noexcept;
+}
+
+/**
+ * @brief Epoch based memory reclamation of nodes removed from lock-free structures
+ * Threads register as participants and access shared nodes inside critical sections (see EpochGuard).
+ * A removed node is retired into the limbo list of the current global epoch, owned by the retiring participant.
+ * The global epoch advances only once every participant inside a critical section observed it,
+ * thus the nodes retired at epoch 'e' are unreachable by any reader once the global epoch reaches 'e + 2'.
+ * Each participant keeps one limbo list per epoch modulo 3 and frees a whole list at once when it becomes safe.
+ */
+class alignas_cacheline kF::Core::EpochManager
+{
+public:
+    /** @brief Function destroying a retired node */
+    using Deleter = void(*)(void * const ptr) noexcept;
+
+    /** @brief Retired node */
+    struct Retired
+    {
+        void *ptr {};
+        Deleter deleter {};
+    };
+
+    /** @brief Nodes retired during the same epoch */
+    struct Limbo
+    {
+        Vector<Retired> list {};
+        std::uint64_t epoch {};
+    };
+
+    /** @brief Number of limbo lists per participant */
+    static constexpr std::size_t LimboCount = 3;
+
+    /** @brief Number of retired nodes between two collections of a participant */
+    static constexpr std::uint32_t CollectThreshold = 64;
+
+    /** @brief Local epoch of a participant outside of any critical section */
+    static constexpr std::uint64_t InactiveEpoch = ~static_cast<std::uint64_t>(0);
+
+    /** @brief Registration record of a thread, records are never freed before their manager and get reused */
+    struct alignas_cacheline Participant
+    {
+        std::atomic<std::uint64_t> epoch { InactiveEpoch };
+        std::atomic<bool> registered {};
+        bool threadOwned {};
+        EpochManager *manager {};
+        Participant *next {};
+        std::uint32_t depth {};
+        std::uint32_t retiredCount {};
+        Limbo limbos[LimboCount] {};
+    };
+
+
+    /** @brief Destructor, every participant must be unregistered, pending nodes are freed */
+    ~EpochManager(void) noexcept;
+
+    /** @brief Default constructor */
+    inline EpochManager(void) noexcept = default;
+
+
+    /** @brief Get the global epoch */
+    [[nodiscard]] inline std::uint64_t epoch(void) const noexcept { return _epoch.load(std::memory_order_acquire); }
+
+
+    /** @brief Register the calling thread, reusing a free record if possible */
+    [[nodiscard]] Participant &registerThread(void) noexcept;
+
+    /** @brief Unregister a participant outside of any critical section
+     *  Participants returned by 'threadParticipant' are owned by their thread and can't be unregistered explicitly
+     *  Nodes that are not safe to free yet stay in the record until it gets reused or the manager is destroyed */
+    void unregisterThread(Participant &participant) noexcept;
+
+    /** @brief Get the participant of the calling thread, registering it on first use
+     *  The participant is unregistered when the thread exits, thus only the shared epoch manager, which outlives
+     *  every thread, supports implicit registration; other managers must use 'registerThread' */
+    [[nodiscard]] Participant &threadParticipant(void) noexcept;
+
+
+    /** @brief Enter a critical section, can be nested */
+    inline void enter(Participant &participant) noexcept;
+
+    /** @brief Leave a critical section */
+    inline void leave(Participant &participant) noexcept;
+
+
+    /** @brief Retire a node removed from a shared structure, it will be destroyed by 'deleter' once no reader can access it */
+    inline void retire(Participant &participant, void * const ptr, const Deleter deleter) noexcept;
+
+    /** @brief Retire a node allocated with 'Allocator', it will be destructed and deallocated once no reader can access it */
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+    inline void retire(Participant &participant, Type * const ptr) noexcept;
+
+    /** @brief Try to advance the global epoch then free the limbo lists of 'participant' that became safe */
+    void collect(Participant &participant) noexcept;
+
+    /** @brief Advance the global epoch if every participant inside a critical section observed it
+     *  @return True if the epoch has been advanced */
+    bool tryAdvance(void) noexcept;
+
+    /** @brief Get the number of nodes retired by a participant that are not freed yet */
+    [[nodiscard]] std::size_t pendingCount(const Participant &participant) const noexcept;
+
+private:
+    alignas_cacheline std::atomic<std::uint64_t> _epoch {};
+    alignas_cacheline std::atomic<Participant *> _participants {};
+
+    /** @brief Destroy every node of a limbo list */
+    static void Release(Limbo &limbo) noexcept;
+
+    /** @brief Copy and move constructors disabled */
+    EpochManager(const EpochManager &other) = delete;
+    EpochManager(EpochManager &&other) = delete;
+};
+
+/** @brief Critical section scope of an epoch manager participant
+ *  Nodes read from shared structures inside the scope cannot be freed until the scope ends. */
+class kF::Core::EpochGuard
+{
+public:
+    /** @brief Destructor, leave the critical section */
+    inline ~EpochGuard(void) noexcept { _participant.manager->leave(_participant); }
+
+    /** @brief Enter a critical section of a participant */
+    inline explicit EpochGuard(EpochManager::Participant &participant) noexcept : _participant(participant)
+        { _participant.manager->enter(_participant); }
+
+    /** @brief Enter a critical section of the calling thread participant of the shared epoch manager */
+    inline EpochGuard(void) noexcept : EpochGuard(SharedEpochManager().threadParticipant()) {}
+
+
+    /** @brief Get the guarded participant */
+    [[nodiscard]] inline EpochManager::Participant &participant(void) const noexcept { return _participant; }
+
+    /** @brief Retire a node removed from a shared structure */
+    inline void retire(void * const ptr, const EpochManager::Deleter deleter) const noexcept
+        { _participant.manager->retire(_participant, ptr, deleter); }
+
+    /** @brief Retire a node allocated with 'Allocator' */
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+    inline void retire(Type * const ptr) const noexcept
+        { _participant.manager->template retire<Type, Allocator>(_participant, ptr); }
+
+private:
+    EpochManager::Participant &_participant;
+
+    /** @brief Copy and move constructors disabled */
+    EpochGuard(const EpochGuard &other) = delete;
+    EpochGuard(EpochGuard &&other) = delete;
+};
+
+#include "EpochManager.ipp"
\ No newline at end of file
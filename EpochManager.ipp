@@ -0,0 +1,48 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Epoch based memory reclamation
+ */
+
+#include "Assert.hpp"
+#include "EpochManager.hpp"
+
+inline void kF::Core::EpochManager::enter(Participant &participant) noexcept
+{
+    kFAssert(participant.manager == this, "EpochManager::enter: Participant belongs to another manager");
+    if (participant.depth++)
+        return;
+    // The sequentially consistent exchange orders the announcement before any read of shared nodes
+    participant.epoch.exchange(_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+}
+
+inline void kF::Core::EpochManager::leave(Participant &participant) noexcept
+{
+    kFAssert(participant.depth, "EpochManager::leave: Participant is not inside a critical section");
+    if (!--participant.depth)
+        participant.epoch.store(InactiveEpoch, std::memory_order_release);
+}
+
+inline void kF::Core::EpochManager::retire(Participant &participant, void * const ptr, const Deleter deleter) noexcept
+{
+    const auto epoch = _epoch.load(std::memory_order_seq_cst);
+    auto &limbo = participant.limbos[epoch % LimboCount];
+
+    // A limbo list of another epoch is at least 'LimboCount' epochs old, thus safe to free
+    if (limbo.epoch != epoch) {
+        Release(limbo);
+        limbo.epoch = epoch;
+    }
+    limbo.list.push(Retired { ptr, deleter });
+    if (++participant.retiredCount >= CollectThreshold) [[unlikely]]
+        collect(participant);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::EpochManager::retire(Participant &participant, Type * const ptr) noexcept
+{
+    retire(participant, ptr, [](void * const ptr) noexcept {
+        const auto node = static_cast<Type *>(ptr);
+        node->~Type();
+        Allocator::Deallocate(node, sizeof(Type), alignof(Type));
+    });
+}
\ No newline at end of file
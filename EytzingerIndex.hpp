@@ -0,0 +1,108 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Eytzinger index
+ */
+
+#pragma once
+
+#include <bit>
+#include <functional>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, typename Compare, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+    class EytzingerIndex;
+}
+
+/** @brief Read-optimized search index over a sorted range (i.e. a SortedVector)
+ *  Keys are copied in Eytzinger (breadth-first) order: the root is node 1 and the children of node 'k' are '2k' and '2k + 1'.
+ *  The top levels of the tree share a few cachelines, each descent step is branchless and the descendants
+ *  of the current node 'log2(PrefetchStride)' levels below are prefetched as a single cacheline.
+ *  Look-ups return positions inside the source range, the index must be built again when the source changes. */
+template<typename Type, typename Compare = std::less<Type>, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::integral Range = std::uint32_t>
+class kF::Core::EytzingerIndex
+{
+public:
+    /** @brief Number of keys per cacheline, the descendants of node 'k' at this depth start at node 'k * PrefetchStride' */
+    static constexpr std::size_t PrefetchStride = std::bit_floor(std::max<std::size_t>(CacheLineSize / sizeof(Type), 1ul));
+
+    /** @brief Alignment of the key array, so that prefetched descendants never straddle two cachelines */
+    static constexpr std::size_t KeyAlignment = std::max(CacheLineSize, alignof(Type));
+
+
+    /** @brief Destructor */
+    inline ~EytzingerIndex(void) noexcept { release(); }
+
+    /** @brief Default constructor */
+    inline EytzingerIndex(void) noexcept = default;
+
+    /** @brief Build constructor, 'sorted' must be sorted using 'Compare' */
+    template<typename Container>
+    inline explicit EytzingerIndex(const Container &sorted) noexcept { build(sorted); }
+
+    /** @brief Build constructor, [from, to[ must be sorted using 'Compare' */
+    template<std::random_access_iterator Iterator>
+    inline EytzingerIndex(const Iterator from, const Iterator to) noexcept { build(from, to); }
+
+    /** @brief Move constructor */
+    inline EytzingerIndex(EytzingerIndex &&other) noexcept { swap(other); }
+
+    /** @brief Move assignment */
+    inline EytzingerIndex &operator=(EytzingerIndex &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    inline void swap(EytzingerIndex &other) noexcept
+        { std::swap(_keys, other._keys); std::swap(_positions, other._positions); std::swap(_size, other._size); }
+
+
+    /** @brief Get the number of indexed keys */
+    [[nodiscard]] inline Range size(void) const noexcept { return _size; }
+
+    /** @brief Check if the index is empty */
+    [[nodiscard]] inline bool empty(void) const noexcept { return !_size; }
+
+
+    /** @brief Build the index from a sorted container */
+    template<typename Container>
+    inline void build(const Container &sorted) noexcept { build(std::begin(sorted), std::end(sorted)); }
+
+    /** @brief Build the index from a sorted range */
+    template<std::random_access_iterator Iterator>
+    void build(const Iterator from, const Iterator to) noexcept;
+
+    /** @brief Release the index */
+    void release(void) noexcept;
+
+
+    /** @brief Get the position of the first key not ordered before 'value', size() if none */
+    [[nodiscard]] inline Range lowerBound(const Type &value) const noexcept
+        { const auto node = lowerBoundNode(value); return node ? _positions[node] : _size; }
+
+    /** @brief Get the position of a key equivalent to 'value', size() if none
+     *  If several keys are equivalent, the position of the first one is returned */
+    [[nodiscard]] inline Range find(const Type &value) const noexcept
+    {
+        const auto node = lowerBoundNode(value);
+        return node && !Compare{}(value, _keys[node]) ? _positions[node] : _size;
+    }
+
+    /** @brief Check if a key equivalent to 'value' is indexed */
+    [[nodiscard]] inline bool contains(const Type &value) const noexcept { return find(value) != _size; }
+
+private:
+    Type *_keys {};
+    Range *_positions {};
+    Range _size {};
+
+    /** @brief Get the node of the first key not ordered before 'value', 0 if none */
+    [[nodiscard]] std::size_t lowerBoundNode(const Type &value) const noexcept;
+
+    /** @brief Fill the subtree of 'node' in order, starting at 'rank' in the source range
+     *  @return The rank following the last filled key */
+    template<std::random_access_iterator Iterator>
+    [[nodiscard]] Range fill(const Iterator from, const std::size_t node, Range rank) noexcept;
+};
+
+#include "EytzingerIndex.ipp"
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Eytzinger index
+ */
+
+#include "Assert.hpp"
+#include "EytzingerIndex.hpp"
+
+template<typename Type, typename Compare, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+template<std::random_access_iterator Iterator>
+inline void kF::Core::EytzingerIndex<Type, Compare, Allocator, Range>::build(const Iterator from, const Iterator to) noexcept
+{
+    const auto size = Distance<Range>(from, to);
+
+    kFAssert(std::is_sorted(from, to, Compare{}), "EytzingerIndex::build: Input range is not sorted");
+    release();
+    if (!size)
+        return;
+    // Node 0 is never used so that the children of node 'k' are '2k' and '2k + 1'
+    _keys = reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * (size + 1ul), KeyAlignment));
+    _positions = reinterpret_cast<Range *>(Allocator::Allocate(sizeof(Range) * (size + 1ul), alignof(Range)));
+    _size = size;
+    [[maybe_unused]] const auto filled = fill(from, 1ul, 0);
+    kFAssert(filled == size, "EytzingerIndex::build: Invalid fill count");
+}
+
+template<typename Type, typename Compare, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::EytzingerIndex<Type, Compare, Allocator, Range>::release(void) noexcept
+{
+    if (!_keys)
+        return;
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        for (std::size_t node = 1; node <= _size; ++node)
+            _keys[node].~Type();
+    }
+    Allocator::Deallocate(_keys, sizeof(Type) * (_size + 1ul), KeyAlignment);
+    Allocator::Deallocate(_positions, sizeof(Range) * (_size + 1ul), alignof(Range));
+    _keys = nullptr;
+    _positions = nullptr;
+    _size = 0;
+}
+
+template<typename Type, typename Compare, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+template<std::random_access_iterator Iterator>
+inline Range kF::Core::EytzingerIndex<Type, Compare, Allocator, Range>::fill(const Iterator from, const std::size_t node, Range rank) noexcept
+{
+    if (node > _size)
+        return rank;
+    rank = fill(from, node * 2ul, rank);
+    new (_keys + node) Type(from[rank]);
+    _positions[node] = rank;
+    return fill(from, node * 2ul + 1ul, rank + 1);
+}
+
+template<typename Type, typename Compare, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline std::size_t kF::Core::EytzingerIndex<Type, Compare, Allocator, Range>::lowerBoundNode(const Type &value) const noexcept
+{
+    const auto keys = reinterpret_cast<std::uintptr_t>(_keys);
+    std::size_t node = 1;
+
+    while (node <= _size) {
+        // The prefetched address may lie past the array, computing it as an integer keeps it well-defined
+        Prefetch(reinterpret_cast<const void *>(keys + node * PrefetchStride * sizeof(Type)));
+        node = node * 2ul + static_cast<std::size_t>(Compare{}(_keys[node], value));
+    }
+    // Walk back the right turns taken after the last left turn, which reached the lower bound
+    return node >> (std::countr_one(node) + 1);
+}
\ No newline at end of file
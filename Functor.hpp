@@ -17,17 +17,30 @@ namespace kF::Core
 
     namespace Internal
     {
+        /** @brief Ensure that a given functor fits inside the cache of Functor (size and alignment) */
+        template<typename Functor, std::size_t CacheSize>
+        concept FunctorFitCacheRequirements = sizeof(Functor) <= CacheSize && alignof(Functor) <= alignof(void *);
+
         /** @brief Ensure that a given functor met the trivial requirements of Functor */
         template<typename Functor, std::size_t CacheSize>
-        concept FunctorCacheRequirements = std::is_trivially_copyable_v<Functor> && sizeof(Functor) <= CacheSize;
+        concept FunctorCacheRequirements = std::is_trivially_copyable_v<Functor>
+            && FunctorFitCacheRequirements<Functor, CacheSize>;
 
-        /** @brief Ensure that a given functor DOES NOT met the trivial requirements of Functor */
+        /** @brief Ensure that a given non-trivial functor can be stored inside the cache of Functor */
         template<typename Functor, std::size_t CacheSize>
-        concept FunctorNoCacheRequirements = (std::is_trivially_copyable_v<Functor> ? sizeof(Functor) > CacheSize : true);
+        concept FunctorInlineCacheRequirements = !std::is_trivially_copyable_v<Functor>
+            && std::is_nothrow_move_constructible_v<Functor>
+            && FunctorFitCacheRequirements<Functor, CacheSize>;
+
+        /** @brief Ensure that a given functor DOES NOT met any cache requirements of Functor */
+        template<typename Functor, std::size_t CacheSize>
+        concept FunctorNoCacheRequirements = !FunctorCacheRequirements<Functor, CacheSize>
+            && !FunctorInlineCacheRequirements<Functor, CacheSize>;
     }
 }
 
-/** @brief General opaque functor that can optimize trivial types that fit 'DesiredSize' */
+/** @brief General opaque functor that stores any nothrow movable functor that fit 'DesiredSize' without allocation
+ *  Trivial functors are moved using memcpy, others use an opaque manager function */
 template<typename Return, typename ...Args, kF::Core::StaticAllocatorRequirements Allocator, std::size_t DesiredSize>
 class kF::Core::Functor<Return(Args...), Allocator, DesiredSize>
 {
@@ -45,7 +58,11 @@ public:
 
     /** @brief Functor signature */
     using OpaqueInvoke = Return(*)(Cache &cache, Args...args);
-    using OpaqueDestructor = void(*)(Cache &cache);
+
+    /** @brief Functor manager signature
+     *  If 'target' is null, destroy the functor stored in 'cache'
+     *  Else, move the functor stored in 'cache' into 'target' and destroy the source */
+    using OpaqueManager = void(*)(Cache &cache, Cache *target) noexcept;
 
     /** @brief Functor return type */
     using ReturnType = Return;
@@ -86,12 +103,7 @@ public:
     inline Functor(void) noexcept = default;
 
     /** @brief Move constructor */
-    inline Functor(Functor &&other) noexcept
-    {
-        std::memcpy(this, &other, sizeof(Functor));
-        other._invoke = nullptr;
-        other._destruct = nullptr;
-    }
+    inline Functor(Functor &&other) noexcept { steal(other); }
 
     /** @brief Prepare constructor, limited to runtime functors due to template constructor restrictions */
     template<typename ClassFunctor>
@@ -103,10 +115,10 @@ public:
     /** @brief Move assignment*/
     inline Functor &operator=(Functor &&other) noexcept
     {
-        release<false>();
-        std::memcpy(this, &other, sizeof(Functor));
-        other._invoke = nullptr;
-        other._destruct = nullptr;
+        if (this != &other) [[likely]] {
+            release<false>();
+            steal(other);
+        }
         return *this;
     }
 
@@ -115,22 +127,50 @@ public:
     template<bool ResetMembers = true>
     inline void release(void) noexcept
     {
-        if (_destruct)
-            _destruct(_cache);
+        if (_manager)
+            _manager(_cache, nullptr);
         if constexpr (ResetMembers) {
             _invoke = nullptr;
-            _destruct = nullptr;
+            _manager = nullptr;
         }
     }
 
     /** @brief Check if the functor is prepared */
     [[nodiscard]] inline operator bool(void) const noexcept { return _invoke; }
 
+    /** @brief Get the opaque invoke function, functors sharing it run the same code */
+    [[nodiscard]] inline OpaqueInvoke invoker(void) const noexcept { return _invoke; }
+
+    /** @brief Invoke internal functor through 'invoke', which must be the invoke function of this functor
+     *  Dispatchers load the invoke function once for a whole group of functors sharing it */
+    inline Return invokeWith(const OpaqueInvoke invoke, Args ...args) const noexcept
+        { return invoke(const_cast<Cache &>(_cache), std::forward<Args>(args)...); }
+
 
     /** @brief Prepare a trivial functor */
     template<typename ClassFunctor>
         requires (!std::is_same_v<Functor, std::remove_cvref_t<ClassFunctor>>
-            && Internal::FunctorCacheRequirements<ClassFunctor, CacheSize>
+            && Internal::FunctorCacheRequirements<std::remove_cvref_t<ClassFunctor>, CacheSize>
+            && InvocableRequirements<ClassFunctor, Return, Args...>)
+    inline void prepare(ClassFunctor &&functor) noexcept
+    {
+        using FlatClassFunctor = std::remove_cvref_t<ClassFunctor>;
+
+        release<false>();
+        _invoke = [](Cache &cache, Args ...args) noexcept -> Return {
+            if constexpr (std::is_same_v<Return, void>)
+                Invoke(CacheAs<FlatClassFunctor>(cache), std::forward<Args>(args)...);
+            else
+                return Invoke(CacheAs<FlatClassFunctor>(cache), std::forward<Args>(args)...);
+        };
+        _manager = nullptr;
+        new (&_cache) FlatClassFunctor(std::forward<ClassFunctor>(functor));
+    }
+
+    /** @brief Prepare a non-trivial functor that fit inside the cache */
+    template<typename ClassFunctor>
+        requires (!std::is_same_v<Functor, std::remove_cvref_t<ClassFunctor>>
+            && Internal::FunctorInlineCacheRequirements<std::remove_cvref_t<ClassFunctor>, CacheSize>
             && InvocableRequirements<ClassFunctor, Return, Args...>)
     inline void prepare(ClassFunctor &&functor) noexcept
     {
@@ -139,18 +179,23 @@ public:
         release<false>();
         _invoke = [](Cache &cache, Args ...args) noexcept -> Return {
             if constexpr (std::is_same_v<Return, void>)
-                Invoke(CacheAs<ClassFunctor>(cache), std::forward<Args>(args)...);
+                Invoke(CacheAs<FlatClassFunctor>(cache), std::forward<Args>(args)...);
             else
-                return Invoke(CacheAs<ClassFunctor>(cache), std::forward<Args>(args)...);
+                return Invoke(CacheAs<FlatClassFunctor>(cache), std::forward<Args>(args)...);
+        };
+        _manager = [](Cache &cache, Cache *target) noexcept {
+            auto &source = CacheAs<FlatClassFunctor>(cache);
+            if (target)
+                new (target) FlatClassFunctor(std::move(source));
+            source.~FlatClassFunctor();
         };
-        _destruct = nullptr;
         new (&_cache) FlatClassFunctor(std::forward<ClassFunctor>(functor));
     }
 
     /** @brief Prepare a non-trivial functor with an allocator */
     template<typename ClassFunctor>
         requires (!std::is_same_v<Functor, std::remove_cvref_t<ClassFunctor>>
-            && Internal::FunctorNoCacheRequirements<ClassFunctor, CacheSize>
+            && Internal::FunctorNoCacheRequirements<std::remove_cvref_t<ClassFunctor>, CacheSize>
             && InvocableRequirements<ClassFunctor, Return, Args...>)
     inline void prepare(ClassFunctor &&functor) noexcept
     {
@@ -165,8 +210,12 @@ public:
         _invoke = [](Cache &cache, Args ...args) noexcept -> Return {
             return Invoke(*reinterpret_cast<ClassFunctorPtr &>(CacheAs<RuntimeAllocation>(cache).ptr), std::forward<Args>(args)...);
         };
-        _destruct = [](Cache &cache) {
+        _manager = [](Cache &cache, Cache *target) noexcept {
             auto &runtime = CacheAs<RuntimeAllocation>(cache);
+            if (target) {
+                CacheAs<RuntimeAllocation>(*target) = runtime;
+                return;
+            }
             reinterpret_cast<ClassFunctorPtr &>(runtime.ptr)->~FlatClassFunctor();
             Allocator::Deallocate(runtime.ptr, sizeof(FlatClassFunctor), alignof(FlatClassFunctor));
         };
@@ -183,7 +232,7 @@ public:
         _invoke = [](Cache &cache, Args ...args) noexcept -> Return {
             return Invoke(MemberFunction, CacheAs<MemberClass *>(cache), std::forward<Args>(args)...);
         };
-        _destruct = nullptr;
+        _manager = nullptr;
         if constexpr (std::is_pointer_v<ClassType>)
             new (&_cache) MemberClass *(instance);
         else
@@ -199,7 +248,7 @@ public:
         _invoke = [](Cache &, Args ...args) noexcept -> Return {
             return Invoke(Function, std::forward<Args>(args)...);
         };
-        _destruct = nullptr;
+        _manager = nullptr;
     }
 
     /** @brief Invoke internal functor */
@@ -207,6 +256,19 @@ public:
 
 private:
     OpaqueInvoke _invoke {};
-    OpaqueDestructor _destruct {};
+    OpaqueManager _manager {};
     Cache _cache {};
+
+    /** @brief Steal the functor of another instance, 'this' must be released */
+    inline void steal(Functor &other) noexcept
+    {
+        _invoke = other._invoke;
+        _manager = other._manager;
+        if (_manager)
+            _manager(other._cache, &_cache);
+        else
+            std::memcpy(&_cache, &other._cache, sizeof(Cache));
+        other._invoke = nullptr;
+        other._manager = nullptr;
+    }
 };
\ No newline at end of file
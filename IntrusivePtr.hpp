@@ -0,0 +1,176 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Intrusive pointer using allocator
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<bool IsAtomic>
+    class IntrusiveReferenceCount;
+
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    class IntrusivePtr;
+}
+
+/** @brief Reference count embedded into types managed by IntrusivePtr
+ *  If 'IsAtomic' is false, the count is a plain integer and instances must be confined to a single thread */
+template<bool IsAtomic = true>
+class kF::Core::IntrusiveReferenceCount
+{
+public:
+    /** @brief Reference count type */
+    using Count = std::conditional_t<IsAtomic, std::atomic<std::uint32_t>, std::uint32_t>;
+
+
+    /** @brief Get the reference count */
+    [[nodiscard]] inline std::uint32_t referenceCount(void) const noexcept
+    {
+        if constexpr (IsAtomic)
+            return _referenceCount.load(std::memory_order_relaxed);
+        else
+            return _referenceCount;
+    }
+
+    /** @brief Increment the reference count */
+    inline void incrementReferenceCount(void) const noexcept
+    {
+        if constexpr (IsAtomic)
+            _referenceCount.fetch_add(1u, std::memory_order_relaxed);
+        else
+            ++_referenceCount;
+    }
+
+    /** @brief Decrement the reference count
+     *  @return True if the last reference was released */
+    [[nodiscard]] inline bool decrementReferenceCount(void) const noexcept
+    {
+        if constexpr (IsAtomic)
+            return _referenceCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u;
+        else
+            return !--_referenceCount;
+    }
+
+protected:
+    /** @brief Destructor */
+    inline ~IntrusiveReferenceCount(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline IntrusiveReferenceCount(void) noexcept = default;
+
+    /** @brief Copy constructor, the reference count belongs to the instance and is not copied */
+    inline IntrusiveReferenceCount(const IntrusiveReferenceCount &) noexcept {}
+
+    /** @brief Copy assignment, the reference count belongs to the instance and is not copied */
+    inline IntrusiveReferenceCount &operator=(const IntrusiveReferenceCount &) noexcept { return *this; }
+
+private:
+    mutable Count _referenceCount {};
+};
+
+/** @brief Shared pointer over a type that embeds its own reference count (i.e. deriving from IntrusiveReferenceCount)
+ *  Instances must be allocated with 'Make' so that the last reference frees them through 'Allocator'.
+ *  Because the count lives inside the instance, a new reference can be created from a raw pointer at any time. */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class kF::Core::IntrusivePtr
+{
+public:
+    /** @brief Allocate an instance */
+    template<typename ...Args>
+    [[nodiscard]] static inline IntrusivePtr Make(Args &&...args) noexcept
+        { return IntrusivePtr(new (Allocator::Allocate(sizeof(Type), alignof(Type))) Type(std::forward<Args>(args)...)); }
+
+
+    /** @brief Destructor */
+    inline ~IntrusivePtr(void) noexcept { release<false>(); }
+
+    /** @brief Construct the intrusive pointer */
+    inline IntrusivePtr(void) noexcept = default;
+
+    /** @brief Construct a new reference over an instance allocated with 'Make' */
+    inline explicit IntrusivePtr(Type * const ptr) noexcept : _ptr(ptr) { if (_ptr) _ptr->incrementReferenceCount(); }
+
+    /** @brief Copy constructor */
+    inline IntrusivePtr(const IntrusivePtr &other) noexcept : IntrusivePtr(other._ptr) {}
+
+    /** @brief Move constructor */
+    inline IntrusivePtr(IntrusivePtr &&other) noexcept : _ptr(other._ptr) { other._ptr = nullptr; }
+
+
+    /** @brief Copy assignment */
+    inline IntrusivePtr &operator=(const IntrusivePtr &other) noexcept
+    {
+        if (other._ptr)
+            other._ptr->incrementReferenceCount();
+        release<false>();
+        _ptr = other._ptr;
+        return *this;
+    }
+
+    /** @brief Move assignment */
+    inline IntrusivePtr &operator=(IntrusivePtr &&other) noexcept { swap(other); return *this; }
+
+
+    /** @brief Boolean check operator */
+    [[nodiscard]] explicit inline operator bool(void) const noexcept { return _ptr != nullptr; }
+
+    /** @brief Boolean check operator */
+    [[nodiscard]] explicit inline operator Type *(void) noexcept { return get(); }
+    [[nodiscard]] explicit inline operator const Type *(void) const noexcept { return get(); }
+
+
+    /** @brief Get reference count */
+    [[nodiscard]] inline std::uint32_t referenceCount(void) const noexcept { return _ptr ? _ptr->referenceCount() : 0u; }
+
+
+    /** @brief Mutable managed object getter */
+    [[nodiscard]] inline Type *get(void) noexcept { return _ptr; }
+
+    /** @brief Constant managed object getter */
+    [[nodiscard]] inline const Type *get(void) const noexcept { return _ptr; }
+
+
+    /** @brief Mutable managed object pointer access */
+    [[nodiscard]] inline Type *operator->(void) noexcept { return _ptr; }
+
+    /** @brief Constant managed object pointer access */
+    [[nodiscard]] inline const Type *operator->(void) const noexcept { return _ptr; }
+
+
+    /** @brief Mutable managed object reference access */
+    [[nodiscard]] inline Type &operator*(void) noexcept { return *_ptr; }
+
+    /** @brief Constant managed object reference access */
+    [[nodiscard]] inline const Type &operator*(void) const noexcept { return *_ptr; }
+
+
+    /** @brief Swaps the managed objects */
+    inline void swap(IntrusivePtr &other) noexcept { std::swap(_ptr, other._ptr); }
+
+    /** @brief Release the reference, destroying the managed object if it was the last one */
+    template<bool ResetMembers = true>
+    inline void release(void) noexcept
+    {
+        if (_ptr && _ptr->decrementReferenceCount()) {
+            _ptr->~Type();
+            Allocator::Deallocate(_ptr, sizeof(Type), alignof(Type));
+        }
+        if constexpr (ResetMembers) {
+            _ptr = nullptr;
+        }
+    }
+
+    /** @brief Comparison operators */
+    [[nodiscard]] inline bool operator==(const IntrusivePtr &other) const noexcept { return _ptr == other._ptr; }
+    [[nodiscard]] inline bool operator!=(const IntrusivePtr &other) const noexcept { return _ptr != other._ptr; }
+    [[nodiscard]] inline bool operator==(const Type * const other) const noexcept { return _ptr == other; }
+    [[nodiscard]] inline bool operator!=(const Type * const other) const noexcept { return _ptr != other; }
+
+private:
+    Type *_ptr {};
+};
\ No newline at end of file
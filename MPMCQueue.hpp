@@ -7,37 +7,89 @@
 
 #include <atomic>
 #include <cstdlib>
+#include <memory>
+#include <algorithm>
+#include <bit>
 
+#include "QueueInstrumentation.hpp"
 #include "Utils.hpp"
 
 namespace kF::Core
 {
-    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    /** @brief Memory layout of MPMCQueue cells */
+    enum class MPMCQueueLayout
+    {
+        Packed, // Cells are contiguous, neighbor cells share cachelines
+        Padded, // Each cell is aligned to a cacheline
+        Remapped // Cells are contiguous but consecutive indexes are spread across cachelines
+    };
+
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
     class MPMCQueue;
 }
 
 /**
  * @brief The MPMC queue is a lock-free queue that supports Multiple Producers and Multiple Consumers
+ * The queue supports ranged push / pop, each range claims its consecutive cells with a single CAS
+ * With many threads, producers and consumers working on neighbor cells suffer from false sharing,
+ * the 'Padded' and 'Remapped' layouts trade memory or locality to prevent it
  *
  * @tparam Type to be inserted
  * @tparam Allocator Static allocator
+ * @tparam Layout Memory layout of cells
+ * @tparam Instrumented If true, the queue records statistics (defaults to 'KUBE_QUEUE_INSTRUMENTATION')
  */
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator,
+        kF::Core::MPMCQueueLayout Layout = kF::Core::MPMCQueueLayout::Packed, bool Instrumented = KUBE_QUEUE_INSTRUMENTATION>
 class alignas_double_cacheline kF::Core::MPMCQueue
 {
 public:
     /** @brief Each cell represent the queued type and a sequence index */
-    struct Cell
+    struct PackedCell
+    {
+        std::atomic<std::size_t> sequence { 0 };
+        Type data;
+    };
+
+    /** @brief Cell aligned to a cacheline */
+    struct alignas_cacheline PaddedCell
     {
         std::atomic<std::size_t> sequence { 0 };
         Type data;
     };
 
+    /** @brief Cell type of the queue */
+    using Cell = std::conditional_t<Layout == MPMCQueueLayout::Padded, PaddedCell, PackedCell>;
+
+    /** @brief Number of cells per cacheline in remapped layout (power of 2) */
+    static constexpr std::size_t RemapCellsPerLine = [] {
+        auto count = 1ul;
+        while (count * 2ul * sizeof(Cell) <= CacheLineSize)
+            count *= 2ul;
+        return count;
+    }();
+
+    /** @brief Alignment of the cell buffer, cacheline groups of remapped and padded layouts must start on a cacheline */
+    static constexpr std::size_t BufferAlignment = Layout == MPMCQueueLayout::Packed ? alignof(Cell) : std::max(alignof(Cell), CacheLineSize);
+
     /** @brief Buffer structure containing all cells */
     struct Buffer
     {
         std::size_t mask { 0 };
         Cell *data {};
+        std::size_t lineMask { 0 }; // Mask of cacheline count (remapped layout only)
+        std::size_t lineShift { 0 }; // Log2 of cacheline count (remapped layout only)
+
+        /** @brief Get the cell at a given position */
+        [[nodiscard]] inline Cell &at(const std::size_t pos) const noexcept
+        {
+            if constexpr (Layout == MPMCQueueLayout::Remapped) {
+                // Consecutive positions are placed in consecutive cachelines
+                const auto index = pos & mask;
+                return data[((index & lineMask) * RemapCellsPerLine) | (index >> lineShift)];
+            } else
+                return data[pos & mask];
+        }
     };
 
     /** @brief Cache of producers or consumers */
@@ -70,23 +122,71 @@ public:
     [[nodiscard]] bool pop(Type &value) noexcept;
 
 
+    /** @brief Push exactly 'count' elements into the queue
+     *  Elements are moved out of [from, to[ and left alive in their moved-from state, the caller keeps ownership of them
+     *  (unlike SPSCQueue and MPSCQueue, whose range push destroys the moved-from sources)
+     *  @return Success on true */
+    template<std::input_iterator InputIterator>
+    [[nodiscard]] inline bool tryPushRange(const InputIterator from, const InputIterator to) noexcept
+        { return pushRangeImpl<false>(from, to); }
+
+    /** @brief Push up to 'count' elements into the queue
+     *  Inserted elements are moved out and left alive in their moved-from state, the caller keeps ownership of them
+     *  @return The number of inserted elements */
+    template<std::input_iterator InputIterator>
+    [[nodiscard]] inline std::size_t pushRange(const InputIterator from, const InputIterator to) noexcept
+        { return pushRangeImpl<true>(from, to); }
+
+
+    /** @brief Pop exactly 'count' elements from the queue
+     *  @return Success on true */
+    template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] inline bool tryPopRange(const OutputIterator from, const OutputIterator to) noexcept
+        { return popRangeImpl<false>(from, to); }
+
+    /** @brief Pop up to 'count' elements from the queue
+     *  @return The number of extracted elements */
+    template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] inline std::size_t popRange(const OutputIterator from, const OutputIterator to) noexcept
+        { return popRangeImpl<true>(from, to); }
+
+
     /** @brief Clear all elements of the queue (unsafe) */
     inline void clear(void) noexcept { for (Type tmp; pop(tmp);); }
 
 
+    /** @brief Get a snapshot of the queue statistics, empty unless 'Instrumented' is true */
+    [[nodiscard]] inline QueueStatistics statistics(void) const noexcept { return _instrumentation.snapshot(); }
+
+    /** @brief Reset the queue statistics */
+    inline void resetStatistics(void) noexcept { _instrumentation.reset(); }
+
+
 private:
     alignas_cacheline std::atomic<std::size_t> _tail { 0 }; // Tail accessed by producers
     alignas_cacheline Cache _tailCache {}; // Cache accessed by producers
     alignas_cacheline std::atomic<std::size_t> _head { 0 }; // Head accessed by consumers
     alignas_cacheline Cache _headCache {}; // Cache accessed by consumers
+    [[no_unique_address]] QueueInstrumentation<Allocator, Instrumented> _instrumentation; // Statistics of the queue (empty when disabled)
 
 
     /** @brief Copy and move constructors disabled */
     MPMCQueue(const MPMCQueue &other) = delete;
     MPMCQueue(MPMCQueue &&other) = delete;
+
+
+    /** @brief Implementation of push range */
+    template<bool AllowLess, std::input_iterator InputIterator>
+    [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to) noexcept;
+
+    /** @brief Implementation of pop range */
+    template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] std::size_t popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept;
 };
 
-static_assert_sizeof(kF::Core::MPMCQueue<int>, 2 * kF::Core::CacheLineDoubleSize);
+static_assert(sizeof(kF::Core::MPMCQueue<int, kF::Core::DefaultStaticAllocator, kF::Core::MPMCQueueLayout::Packed, false>) == 2 * kF::Core::CacheLineDoubleSize,
+    "MPMCQueue without instrumentation must have a size of 2 * kF::Core::CacheLineDoubleSize");
 static_assert_alignof_double_cacheline(kF::Core::MPMCQueue<int>);
+static_assert_sizeof(kF::Core::MPMCQueue<int>::PaddedCell, kF::Core::CacheLineSize);
 
 #include "MPMCQueue.ipp"
\ No newline at end of file
@@ -5,52 +5,59 @@
 
 #include "Abort.hpp"
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::MPMCQueue<Type, Allocator>::~MPMCQueue(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+inline kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::~MPMCQueue(void) noexcept
 {
     clear();
-    Allocator::Deallocate(_headCache.buffer.data, sizeof(Cell) * (_headCache.buffer.mask + 1), alignof(Cell));
+    Allocator::Deallocate(_headCache.buffer.data, sizeof(Cell) * (_headCache.buffer.mask + 1), BufferAlignment);
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::MPMCQueue<Type, Allocator>::MPMCQueue(const std::size_t capacity) noexcept
-    : _tailCache(Cache { Buffer { capacity - 1, nullptr } })
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+inline kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::MPMCQueue(const std::size_t capacity) noexcept
+    : _tailCache(Cache { Buffer { capacity - 1, nullptr } }), _instrumentation(capacity)
 {
+    // Compute the cacheline mapping, small queues fallback to an identity mapping
+    if constexpr (Layout == MPMCQueueLayout::Remapped) {
+        const auto lineCount = std::max(capacity / RemapCellsPerLine, 1ul);
+        _tailCache.buffer.lineMask = lineCount - 1;
+        _tailCache.buffer.lineShift = static_cast<std::size_t>(std::countr_zero(lineCount));
+    }
     kFEnsure((capacity >= 2) && (capacity & (capacity - 1ul)) == 0, // Ensure capacity is  a power of two >= 2
         "Core::MPMCQueue: Buffer capacity must be a power of 2 (", capacity, ')');
-    _tailCache.buffer.data = reinterpret_cast<Cell *>(Allocator::Allocate(sizeof(Cell) * capacity, alignof(Cell)));
+    _tailCache.buffer.data = reinterpret_cast<Cell *>(Allocator::Allocate(sizeof(Cell) * capacity, BufferAlignment));
     kFEnsure(_tailCache.buffer.data, // Ensure allocation succeed
         "Core::MPMCQueue: Allocation of capacity ", capacity, " failed");
 
     // Init cells
     for (auto i = 0ul; i != capacity; ++i)
-        new (&_tailCache.buffer.data[i].sequence) decltype(Cell::sequence)(i);
+        new (&_tailCache.buffer.at(i).sequence) decltype(Cell::sequence)(i);
     _headCache = _tailCache;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline std::size_t kF::Core::MPMCQueue<Type, Allocator>::size(void) const noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+inline std::size_t kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::size(void) const noexcept
 {
     return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_relaxed);
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
 template<bool MoveOnSuccess, typename ...Args>
-inline bool kF::Core::MPMCQueue<Type, Allocator>::push(Args &&...args) noexcept
+inline bool kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::push(Args &&...args) noexcept
 {
     auto pos = _tail.load(std::memory_order_relaxed);
-    auto * const data = _tailCache.buffer.data;
-    const auto mask = _tailCache.buffer.mask;
+    const auto &buffer = _tailCache.buffer;
     Cell *cell;
 
     while (true) {
-        cell = &data[pos & mask];
+        cell = &buffer.at(pos);
         const auto sequence = cell->sequence.load(std::memory_order_acquire);
         if (sequence == pos) [[likely]] {
             if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) [[likely]]
                 break;
-        } else if (sequence < pos) [[unlikely]]
+        } else if (sequence < pos) [[unlikely]] {
+            _instrumentation.onPushFailure();
             return false;
+        }
         else
             pos = _tail.load(std::memory_order_relaxed);
     }
@@ -58,20 +65,20 @@ inline bool kF::Core::MPMCQueue<Type, Allocator>::push(Args &&...args) noexcept
         new (&cell->data) Type(std::move(args)...);
     else
         new (&cell->data) Type(std::forward<Args>(args)...);
+    _instrumentation.onPush(pos & buffer.mask, 1, [this, pos] { return pos + 1 - _head.load(std::memory_order_relaxed); });
     cell->sequence.store(pos + 1, std::memory_order_release);
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline bool kF::Core::MPMCQueue<Type, Allocator>::pop(Type &value) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+inline bool kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::pop(Type &value) noexcept
 {
     auto pos = _head.load(std::memory_order_relaxed);
-    const auto mask = _headCache.buffer.mask;
-    auto * const data = _headCache.buffer.data;
+    const auto &buffer = _headCache.buffer;
     Cell *cell;
 
     while (true) {
-        cell = &data[pos & mask];
+        cell = &buffer.at(pos);
         const auto sequence = cell->sequence.load(std::memory_order_acquire);
         const auto next = pos + 1;
         if (sequence == next) [[likely]] {
@@ -87,6 +94,122 @@ inline bool kF::Core::MPMCQueue<Type, Allocator>::pop(Type &value) noexcept
     else
         value = cell->data;
     cell->data.~Type();
-    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    _instrumentation.onPop(pos & buffer.mask, 1);
+    cell->sequence.store(pos + buffer.mask + 1, std::memory_order_release);
     return true;
 }
+
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+template<bool AllowLess, std::input_iterator InputIterator>
+inline std::size_t kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
+{
+    const auto &buffer = _tailCache.buffer;
+    const auto mask = buffer.mask;
+    auto pos = _tail.load(std::memory_order_relaxed);
+    std::size_t toPush = static_cast<std::size_t>(std::distance(from, to));
+
+    if (!toPush) [[unlikely]]
+        return 0;
+    else if (toPush > mask + 1) [[unlikely]] {
+        if constexpr (AllowLess)
+            toPush = mask + 1;
+        else {
+            _instrumentation.onPushFailure();
+            return 0;
+        }
+    }
+    const auto requested = toPush;
+    while (true) {
+        // Count consecutive free cells without modifying the queue
+        auto sequence = pos;
+        for (toPush = 0; toPush != requested; ++toPush) {
+            sequence = buffer.at(pos + toPush).sequence.load(std::memory_order_acquire);
+            if (sequence != pos + toPush)
+                break;
+        }
+        if (toPush != requested) [[unlikely]] {
+            // If the sequence is ahead, tail is outdated
+            if (sequence > pos + toPush) {
+                if (!AllowLess || !toPush) {
+                    pos = _tail.load(std::memory_order_relaxed);
+                    continue;
+                }
+            // If the queue is full abort
+            } else if (!AllowLess || !toPush) {
+                _instrumentation.onPushFailure();
+                return 0;
+            }
+        }
+        // Claim every free cell at once
+        if (_tail.compare_exchange_weak(pos, pos + toPush, std::memory_order_relaxed)) [[likely]]
+            break;
+    }
+    if (toPush != static_cast<std::size_t>(std::distance(from, to))) [[unlikely]]
+        _instrumentation.onPushFailure();
+    _instrumentation.onPush(pos & mask, toPush, [this, pos, toPush] { return pos + toPush - _head.load(std::memory_order_relaxed); });
+    // Transaction is secured, construct and publish each cell
+    auto it = from;
+    for (auto i = 0ul; i != toPush; ++i, ++it) {
+        auto &cell = buffer.at(pos + i);
+        new (&cell.data) Type(std::move(*it));
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return toPush;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, kF::Core::MPMCQueueLayout Layout, bool Instrumented>
+template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+inline std::size_t kF::Core::MPMCQueue<Type, Allocator, Layout, Instrumented>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
+{
+    const auto &buffer = _headCache.buffer;
+    const auto mask = buffer.mask;
+    auto pos = _head.load(std::memory_order_relaxed);
+    std::size_t toPop = static_cast<std::size_t>(std::distance(from, to));
+
+    if (!toPop) [[unlikely]]
+        return 0;
+    else if (toPop > mask + 1) [[unlikely]] {
+        if constexpr (AllowLess)
+            toPop = mask + 1;
+        else
+            return 0;
+    }
+    const auto requested = toPop;
+    while (true) {
+        // Count consecutive published cells without modifying the queue
+        auto sequence = pos;
+        for (toPop = 0; toPop != requested; ++toPop) {
+            sequence = buffer.at(pos + toPop).sequence.load(std::memory_order_acquire);
+            if (sequence != pos + toPop + 1)
+                break;
+        }
+        if (toPop != requested) [[unlikely]] {
+            // If the sequence is ahead, head is outdated
+            if (sequence > pos + toPop + 1) {
+                if (!AllowLess || !toPop) {
+                    pos = _head.load(std::memory_order_relaxed);
+                    continue;
+                }
+            // If the queue is empty abort
+            } else if (!AllowLess || !toPop)
+                return 0;
+        }
+        // Claim every published cell at once
+        if (_head.compare_exchange_weak(pos, pos + toPop, std::memory_order_relaxed)) [[likely]]
+            break;
+    }
+    _instrumentation.onPop(pos & mask, toPop);
+    // Transaction is secured, extract and release each cell
+    auto it = from;
+    for (auto i = 0ul; i != toPop; ++i, ++it) {
+        auto &cell = buffer.at(pos + i);
+        if constexpr (std::is_move_assignable_v<Type>)
+            *it = std::move(cell.data);
+        else
+            *it = cell.data;
+        cell.data.~Type();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    return toPop;
+}
\ No newline at end of file
@@ -10,22 +10,25 @@
 #include <memory>
 #include <algorithm>
 
+#include "QueueInstrumentation.hpp"
 #include "Utils.hpp"
 
 namespace kF::Core
 {
-    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
     class MPSCQueue;
 }
 
 /**
  * @brief The MPSC queue is a lock-free queue that supports a Multiple Producers and Single Consumer
  * The queue supports ranged push / pop to insert multiple elements without performance impact
+ * Elements can also be constructed and read in place using reserve / commit and peek / release
  *
  * @tparam Type to be inserted
  * @tparam Allocator Static allocator
+ * @tparam Instrumented If true, the queue records statistics (defaults to 'KUBE_QUEUE_INSTRUMENTATION')
  */
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, bool Instrumented = KUBE_QUEUE_INSTRUMENTATION>
 class alignas_double_cacheline kF::Core::MPSCQueue
 {
 public:
@@ -99,6 +102,36 @@ public:
         { return popRangeImpl<true>(from, to); }
 
 
+    /** @brief Reserve up to 'maxCount' contiguous cells to construct elements in place
+     *  Cells are uninitialized, elements must be constructed before being committed
+     *  @return Reserved cells, empty if the queue is full */
+    [[nodiscard]] inline IteratorRange<Type *> reserve(const std::size_t maxCount) noexcept
+        { return reserveImpl<true>(maxCount); }
+
+    /** @brief Reserve exactly 'count' contiguous cells to construct elements in place
+     *  Reservations never wrap around the end of the ring, when too few cells remain before its end they are filled with
+     *  copies of 'padding' and committed so that the tail wraps. Consumers must discard padding elements
+     *  Retrying always succeeds once the consumer frees enough cells, even if the queue was empty near the end of the ring
+     *  @return Reserved cells, empty if 'count' contiguous cells are not available */
+    [[nodiscard]] inline IteratorRange<Type *> tryReserve(const std::size_t count, const Type &padding) noexcept
+        requires std::copy_constructible<Type>
+        { return reserveImpl<false, true>(count, &padding); }
+
+    /** @brief Publish a whole reservation, every cell must be constructed
+     *  Reservations are published in order, this may wait producers that reserved before */
+    void commit(const IteratorRange<Type *> &reservation) noexcept;
+
+    /** @brief Get the first element of the queue without extracting it
+     *  @return Pointer to the element or nullptr if the queue is empty */
+    [[nodiscard]] Type *peek(void) noexcept;
+
+    /** @brief Get up to 'maxCount' contiguous elements of the queue without extracting them */
+    [[nodiscard]] IteratorRange<Type *> peekRange(const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept;
+
+    /** @brief Destroy and release the first 'count' peeked elements */
+    void release(const std::size_t count) noexcept;
+
+
     /** @brief Clear all elements of the queue (unsafe) */
     void clear(void) noexcept;
 
@@ -107,12 +140,20 @@ public:
     [[nodiscard]] std::size_t size(void) const noexcept;
 
 
+    /** @brief Get a snapshot of the queue statistics, empty unless 'Instrumented' is true */
+    [[nodiscard]] inline QueueStatistics statistics(void) const noexcept { return _instrumentation.snapshot(); }
+
+    /** @brief Reset the queue statistics */
+    inline void resetStatistics(void) noexcept { _instrumentation.reset(); }
+
+
 private:
     alignas_cacheline std::atomic<size_t> _tail { 0 }; // Tail accessed by both producer and consumer threads
     alignas_cacheline ProducerCache _tailCache {}; // Cache accessed by producer thread
 
     alignas_cacheline std::atomic<size_t> _head { 0 }; // Head accessed by both producer and consumers threads
     alignas_cacheline ConsumerCache _headCache {}; // Cache accessed by consumer threads
+    [[no_unique_address]] QueueInstrumentation<Allocator, Instrumented> _instrumentation; // Statistics of the queue (empty when disabled)
 
 
     /** @brief Copy and move constructors disabled */
@@ -120,6 +161,18 @@ private:
     MPSCQueue(MPSCQueue &&other) = delete;
 
 
+    /** @brief Get the number of elements between the current head and 'tail' */
+    [[nodiscard]] inline std::size_t sizeUntil(const std::size_t tail) const noexcept
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : _tailCache.buffer.capacity - head + tail;
+    }
+
+
+    /** @brief Implementation of reserve, if 'Pad' is true the end of the ring is padded when it is too small */
+    template<bool AllowLess, bool Pad = false>
+    [[nodiscard]] IteratorRange<Type *> reserveImpl(const std::size_t count, const Type * const padding = nullptr) noexcept;
+
     /** @brief Implementation of push range */
     template<bool AllowLess, std::input_iterator InputIterator>
     [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to) noexcept;
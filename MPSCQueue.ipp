@@ -3,24 +3,25 @@
  * @ Description: MPSC Queue
  */
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::MPSCQueue<Type, Allocator>::~MPSCQueue(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::MPSCQueue<Type, Allocator, Instrumented>::~MPSCQueue(void) noexcept
 {
     clear();
     Allocator::Deallocate(_headCache.buffer.data, sizeof(Type) * _headCache.buffer.capacity, alignof(Type));
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::MPSCQueue<Type, Allocator>::MPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::MPSCQueue<Type, Allocator, Instrumented>::MPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+    : _instrumentation(capacity + usedAsBuffer)
 {
     _tailCache.buffer.capacity = capacity + usedAsBuffer;
     _tailCache.buffer.data = reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * _tailCache.buffer.capacity, alignof(Type)));
     _headCache.buffer = _tailCache.buffer;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool MoveOnSuccess, typename ...Args>
-inline bool kF::Core::MPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
+inline bool kF::Core::MPSCQueue<Type, Allocator, Instrumented>::push(Args &&...args) noexcept
 {
     auto tail = _tailCache.value.load(std::memory_order_acquire);
     auto head = _head.load(std::memory_order_acquire);
@@ -31,8 +32,10 @@ inline bool kF::Core::MPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
         if (next == _tailCache.buffer.capacity) [[unlikely]]
             next = 0;
         // If queue is full abort
-        if (next == head) [[unlikely]]
+        if (next == head) [[unlikely]] {
+            _instrumentation.onPushFailure();
             return false;
+        }
         // Try to set the tail value shared to producers to peserve data during insertion
         else if (_tailCache.value.compare_exchange_weak(tail, next, std::memory_order_acq_rel)) [[likely]]
             break;
@@ -42,6 +45,7 @@ inline bool kF::Core::MPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
         new (_tailCache.buffer.data + tail) Type(std::move(args)...);
     else
         new (_tailCache.buffer.data + tail) Type(std::forward<Args>(args)...);
+    _instrumentation.onPush(tail, 1, [this, next] { return sizeUntil(next); });
     // Loop while the transaction is not done (may wait prior thread with longer insertion)
     auto expected = tail;
     while (!_tail.compare_exchange_weak(expected, next, std::memory_order_acq_rel)) [[unlikely]]
@@ -49,8 +53,8 @@ inline bool kF::Core::MPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline bool kF::Core::MPSCQueue<Type, Allocator>::pop(Type &value) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline bool kF::Core::MPSCQueue<Type, Allocator, Instrumented>::pop(Type &value) noexcept
 {
     const auto head = _head.load(std::memory_order_relaxed);
 
@@ -68,13 +72,14 @@ inline bool kF::Core::MPSCQueue<Type, Allocator>::pop(Type &value) noexcept
     else
         value = *elem;
     elem->~Type();
+    _instrumentation.onPop(head, 1);
     _head.store(next, std::memory_order_release);
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, std::input_iterator InputIterator>
-inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
+inline std::size_t kF::Core::MPSCQueue<Type, Allocator, Instrumented>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
 {
     const auto capacity = _tailCache.buffer.capacity;
     auto tail = _tailCache.value.load(std::memory_order_acquire);
@@ -84,7 +89,7 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
     bool splitInsert = false;
 
     while (true) {
-        auto available = tail - head;
+        auto available = capacity - (tail - head);
         if (available > capacity) [[unlikely]]
             available -= capacity;
         if (toPush >= available) [[unlikely]] {
@@ -95,8 +100,10 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
             if (toPush >= available) [[unlikely]] {
                 if constexpr (AllowLess)
                     toPush = available - 1;
-                else
+                else {
+                    _instrumentation.onPushFailure();
                     return 0;
+                }
             }
         }
         // Determine the next tail
@@ -110,6 +117,8 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
         if (_tailCache.value.compare_exchange_weak(tail, next, std::memory_order_acq_rel)) [[likely]]
             break;
     }
+    if (toPush != static_cast<std::size_t>(to - from)) [[unlikely]]
+        _instrumentation.onPushFailure();
     // Transaction is secured until tail is modified
     if (splitInsert) {
         const auto split = toPush - next;
@@ -121,6 +130,7 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
         std::uninitialized_move_n(from, toPush, _tailCache.buffer.data + tail);
         std::destroy_n(from, toPush);
     }
+    _instrumentation.onPush(tail, toPush, [this, next] { return sizeUntil(next); });
     // Loop while the transaction is not done (may wait prior thread with longer insertion)
     auto expected = tail;
     while (!_tail.compare_exchange_weak(expected, next, std::memory_order_acq_rel)) [[unlikely]]
@@ -128,9 +138,9 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
     return toPush;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
-inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
+inline std::size_t kF::Core::MPSCQueue<Type, Allocator, Instrumented>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
 {
     std::size_t toPop = to - from;
     const auto head = _head.load(std::memory_order_relaxed);
@@ -164,18 +174,124 @@ inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::popRangeImpl(const Outp
         std::copy_n(std::make_move_iterator(_headCache.buffer.data + head), toPop, from);
         std::destroy_n(_headCache.buffer.data + head, toPop);
     }
+    _instrumentation.onPop(head, toPop);
     _head.store(next, std::memory_order_release);
     return toPop;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::Core::MPSCQueue<Type, Allocator>::clear(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+template<bool AllowLess, bool Pad>
+inline kF::Core::IteratorRange<Type *> kF::Core::MPSCQueue<Type, Allocator, Instrumented>::reserveImpl(const std::size_t count, const Type * const padding) noexcept
+{
+    const auto capacity = _tailCache.buffer.capacity;
+    auto tail = _tailCache.value.load(std::memory_order_acquire);
+    std::size_t toReserve;
+    std::size_t toPad;
+
+    while (true) {
+        // Writable cells are contiguous up to the cell preceding head or the end of the buffer
+        const auto head = _head.load(std::memory_order_acquire);
+        const auto available = head > tail ? head - tail - 1 : capacity - tail - !head;
+        auto next = tail;
+        toPad = 0;
+        if (available >= count) [[likely]]
+            toReserve = count;
+        // Pad the end of the ring so that the tail wraps, unless head is at the beginning or count can't ever fit
+        else if (Pad && head && head <= tail && count < capacity) {
+            toPad = available;
+            toReserve = head - 1 >= count ? count : 0;
+            next = 0;
+        } else if (AllowLess && available)
+            toReserve = available;
+        else {
+            _instrumentation.onPushFailure();
+            return IteratorRange<Type *> {};
+        }
+        next += toReserve;
+        if (next == capacity) [[unlikely]]
+            next = 0;
+        // Try to set the tail value shared to producers to preserve cells until commit
+        if (_tailCache.value.compare_exchange_weak(tail, next, std::memory_order_acq_rel)) [[likely]]
+            break;
+    }
+    if constexpr (Pad) {
+        if (toPad) [[unlikely]] {
+            const auto pad = IteratorRange<Type *> { _tailCache.buffer.data + tail, _tailCache.buffer.data + tail + toPad };
+            for (auto &cell : pad)
+                new (&cell) Type(*padding);
+            commit(pad);
+            tail = 0;
+        }
+    }
+    if (toReserve != count) [[unlikely]]
+        _instrumentation.onPushFailure();
+    return IteratorRange<Type *> { _tailCache.buffer.data + tail, _tailCache.buffer.data + tail + toReserve };
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::MPSCQueue<Type, Allocator, Instrumented>::commit(const IteratorRange<Type *> &reservation) noexcept
+{
+    if (reservation.empty()) [[unlikely]]
+        return;
+    const auto tail = static_cast<std::size_t>(reservation.begin() - _tailCache.buffer.data);
+    auto next = tail + reservation.size();
+    if (next == _tailCache.buffer.capacity) [[unlikely]]
+        next = 0;
+    _instrumentation.onPush(tail, reservation.size(), [this, next] { return sizeUntil(next); });
+    // Loop while the transaction is not done (may wait prior thread with longer insertion)
+    auto expected = tail;
+    while (!_tail.compare_exchange_weak(expected, next, std::memory_order_acq_rel)) [[unlikely]]
+        expected = tail;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline Type *kF::Core::MPSCQueue<Type, Allocator, Instrumented>::peek(void) noexcept
+{
+    const auto range = peekRange(1);
+
+    return range.empty() ? nullptr : range.begin();
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::IteratorRange<Type *> kF::Core::MPSCQueue<Type, Allocator, Instrumented>::peekRange(const std::size_t maxCount) noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.buffer.capacity;
+    // Readable cells are contiguous up to the tail or the end of the buffer
+    const auto contiguousCount = [head, capacity](const std::size_t tail) { return tail >= head ? tail - head : capacity - head; };
+    auto count = contiguousCount(_headCache.value);
+
+    if (count < maxCount) [[unlikely]] {
+        _headCache.value = _tail.load(std::memory_order_acquire);
+        count = contiguousCount(_headCache.value);
+    }
+    count = std::min(count, maxCount);
+    return IteratorRange<Type *> { _headCache.buffer.data + head, _headCache.buffer.data + head + count };
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::MPSCQueue<Type, Allocator, Instrumented>::release(const std::size_t count) noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    auto next = head + count;
+
+    std::destroy_n(_headCache.buffer.data + head, count);
+    if (next == _headCache.buffer.capacity) [[unlikely]]
+        next = 0;
+    _instrumentation.onPop(head, count);
+    _head.store(next, std::memory_order_release);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::MPSCQueue<Type, Allocator, Instrumented>::clear(void) noexcept
 {
-    for (Type type; pop(type););
+    // Elements are destroyed in place, 'Type' doesn't have to be default constructible
+    for (auto range = peekRange(); !range.empty(); range = peekRange())
+        release(range.size());
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline std::size_t kF::Core::MPSCQueue<Type, Allocator>::size(void) const noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline std::size_t kF::Core::MPSCQueue<Type, Allocator, Instrumented>::size(void) const noexcept
 {
     const auto tail = _tail.load(std::memory_order_seq_cst);
     const auto capacity = _tailCache.buffer.capacity;
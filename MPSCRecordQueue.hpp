@@ -0,0 +1,21 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MPSC Record Queue
+ */
+
+#pragma once
+
+#include "RecordQueueDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief The MPSC record queue is a lock-free queue of heterogeneous records that supports Multiple Producers and a Single Consumer
+     * Records are constructed inline inside the ring with 'emplace<Type>(args...)' and visited by 'consume(visitor)'
+     *
+     * @tparam Types std::tuple of the record types that can be inserted
+     * @tparam Allocator Static allocator
+     */
+    template<typename Types, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+    using MPSCRecordQueue = Internal::RecordQueueDetails<Types, Allocator, true>;
+}
\ No newline at end of file
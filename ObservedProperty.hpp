@@ -6,6 +6,7 @@
 #pragma once
 
 #include "RemovableDispatcher.hpp"
+#include "ObservedPropertyBatch.hpp"
 
 namespace kF::Core
 {
@@ -20,6 +21,11 @@ namespace kF::Core
         || requires(const Type &lhs, const Type &rhs) { { lhs == rhs } -> std::same_as<bool>; };
 }
 
+/** @brief Property that dispatches its value on change
+ *  Notifications are coalesced while an ObservedPropertyBatch is alive on the current thread
+ *  A property marked dirty by a batch must not be moved or destroyed by another thread until that batch flushes
+ *  A property changed inside a batch dispatches once with its final value, even if that value equals the one
+ *  it had when the batch opened (ex: A -> B -> A still dispatches A) */
 template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
 class kF::Core::ObservedProperty
 {
@@ -27,8 +33,15 @@ public:
     /** @brief Property dispatcher */
     using Dispatcher = Core::RemovableDispatcher<void(const Type &)>;
 
+    /** @brief Dirty index of a property that is not waiting for a batch flush */
+    static constexpr std::uint32_t NotDirty = ~static_cast<std::uint32_t>(0);
+
     /** @brief Destructor */
-    ~ObservedProperty(void) noexcept = default;
+    inline ~ObservedProperty(void) noexcept
+    {
+        if (_dirtyIndex != NotDirty) [[unlikely]]
+            ObservedPropertyBatch::Unmark(_dirtyIndex, this);
+    }
 
     /** @brief Default constructor */
     inline ObservedProperty(void) noexcept
@@ -38,7 +51,13 @@ public:
     /** @brief Move constructor */
     inline ObservedProperty(ObservedProperty &&other) noexcept
         requires std::is_move_constructible_v<Type>
-        : _value(std::move(other._value)), _dispatcher(std::move(other._dispatcher)) {}
+        : _value(std::move(other._value)), _dispatcher(std::move(other._dispatcher)), _dirtyIndex(other._dirtyIndex)
+    {
+        if (_dirtyIndex != NotDirty) [[unlikely]] {
+            other._dirtyIndex = NotDirty;
+            ObservedPropertyBatch::Relocate(_dirtyIndex, &other, this);
+        }
+    }
 
     /** @brief Copy value constructor */
     explicit inline ObservedProperty(const Type &value) noexcept
@@ -56,6 +75,13 @@ public:
     {
         _value = std::move(other._value);
         _dispatcher = std::move(other._dispatcher);
+        if (other._dirtyIndex != NotDirty) [[unlikely]] {
+            if (_dirtyIndex != NotDirty)
+                ObservedPropertyBatch::Unmark(_dirtyIndex, this);
+            _dirtyIndex = other._dirtyIndex;
+            other._dirtyIndex = NotDirty;
+            ObservedPropertyBatch::Relocate(_dirtyIndex, &other, this);
+        }
         return *this;
     }
 
@@ -66,7 +92,7 @@ public:
         if (_value == value)
             return *this;
         _value = value;
-        _dispatcher.dispatch(_value);
+        notify();
         return *this;
     }
 
@@ -77,7 +103,7 @@ public:
         if (_value == value)
             return *this;
         _value = std::move(value);
-        _dispatcher.dispatch(_value);
+        notify();
         return *this;
     }
 
@@ -115,4 +141,22 @@ public:
 private:
     Type _value;
     Dispatcher _dispatcher {};
+    std::uint32_t _dirtyIndex { NotDirty };
+
+    /** @brief Dispatch the value or mark the property dirty if a batch is active */
+    inline void notify(void) noexcept
+    {
+        if (!ObservedPropertyBatch::IsActive()) [[likely]]
+            _dispatcher.dispatch(_value);
+        else if (_dirtyIndex == NotDirty)
+            _dirtyIndex = ObservedPropertyBatch::MarkDirty(this, &Flush);
+    }
+
+    /** @brief Dispatch the final value of a dirty property */
+    static inline void Flush(void * const property) noexcept
+    {
+        auto &self = *static_cast<ObservedProperty *>(property);
+        self._dirtyIndex = NotDirty;
+        self._dispatcher.dispatch(self._value);
+    }
 };
\ No newline at end of file
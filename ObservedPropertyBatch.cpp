@@ -0,0 +1,27 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Observed property batch
+ */
+
+#include "ObservedPropertyBatch.hpp"
+
+using namespace kF;
+
+std::uint32_t Core::ObservedPropertyBatch::MarkDirty(void * const property, const FlushFunc flush) noexcept
+{
+    DirtyList.push(Entry { property, flush });
+    return DirtyList.size() - 1;
+}
+
+void Core::ObservedPropertyBatch::Flush(void) noexcept
+{
+    // Entries are consumed before being flushed, so a dispatched functor may open and flush a nested batch
+    for (std::uint32_t i = 0; i < DirtyList.size(); ++i) {
+        const auto entry = DirtyList[i];
+        if (!entry.property)
+            continue;
+        DirtyList[i].property = nullptr;
+        entry.flush(entry.property);
+    }
+    DirtyList.clear();
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Observed property batch
+ */
+
+#pragma once
+
+#include "Assert.hpp"
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    class ObservedPropertyBatch;
+}
+
+/**
+ * @brief Scope that coalesces the change notifications of observed properties of the current thread
+ * While a batch is alive, changing a property marks it dirty instead of dispatching.
+ * When the outermost batch is destroyed, each dirty property dispatches once with its final value.
+ * Batches can be nested, only the outermost one flushes.
+ * Dirty properties keep the index of their entry so that they can be unmarked or relocated in constant time.
+ * The index refers to the dirty list of the thread that marked the property, only this thread may unmark or relocate it.
+ */
+class kF::Core::ObservedPropertyBatch
+{
+public:
+    /** @brief Function dispatching the final value of a dirty property */
+    using FlushFunc = void(*)(void * const property) noexcept;
+
+    /** @brief Dirty property entry */
+    struct Entry
+    {
+        void *property {};
+        FlushFunc flush {};
+    };
+
+
+    /** @brief Destructor, flush dirty properties if this is the outermost batch */
+    inline ~ObservedPropertyBatch(void) noexcept { if (!--Depth) Flush(); }
+
+    /** @brief Default constructor, open a batch scope */
+    inline ObservedPropertyBatch(void) noexcept { ++Depth; }
+
+
+    /** @brief Check if a batch is active on the current thread */
+    [[nodiscard]] static inline bool IsActive(void) noexcept { return Depth; }
+
+    /** @brief Register a dirty property, it must not be already registered
+     *  @return Index of the property entry, valid until the property is flushed */
+    [[nodiscard]] static std::uint32_t MarkDirty(void * const property, const FlushFunc flush) noexcept;
+
+    /** @brief Unregister a dirty property that is being destroyed */
+    static inline void Unmark(const std::uint32_t index, [[maybe_unused]] const void * const property) noexcept
+    {
+        kFAssert(index < DirtyList.size() && DirtyList[index].property == property,
+            "ObservedPropertyBatch::Unmark: Property was marked dirty by another thread");
+        DirtyList[index].property = nullptr;
+    }
+
+    /** @brief Replace a dirty property by another one that took its place */
+    static inline void Relocate(const std::uint32_t index, [[maybe_unused]] const void * const from, void * const to) noexcept
+    {
+        kFAssert(index < DirtyList.size() && DirtyList[index].property == from,
+            "ObservedPropertyBatch::Relocate: Property was marked dirty by another thread");
+        DirtyList[index].property = to;
+    }
+
+private:
+    static inline thread_local std::uint32_t Depth {};
+    static inline thread_local Vector<Entry> DirtyList {};
+
+    /** @brief Dispatch every dirty property */
+    static void Flush(void) noexcept;
+
+    /** @brief Copy and move constructors disabled */
+    ObservedPropertyBatch(const ObservedPropertyBatch &other) = delete;
+    ObservedPropertyBatch(ObservedPropertyBatch &&other) = delete;
+};
\ No newline at end of file
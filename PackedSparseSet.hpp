@@ -0,0 +1,151 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Packed sparse set
+ */
+
+#pragma once
+
+#include "UniquePtr.hpp"
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+    class PackedSparseSet;
+}
+
+/** @brief The packed sparse set maps sparse indexes to values stored contiguously
+ *  Sparse indexes are translated into dense indexes through pages of 'PageSize' entries allocated on demand.
+ *  Values and their sparse indexes are packed in two dense arrays which can be iterated without holes.
+ *  Add, remove and look-up are O(1), removing swaps the last value into the hole, thus dense order is not stable.
+ *  Each page counts its live indexes and is released as soon as its last index is removed. */
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::integral Range = std::uint32_t>
+class kF::Core::PackedSparseSet
+{
+public:
+    /** @brief Dense index of sparse indexes that are not in the set */
+    static constexpr Range NullIndex = ~static_cast<Range>(0);
+
+    /** @brief Page translating sparse indexes into dense indexes */
+    struct Page
+    {
+        Range data[PageSize];
+        Range count {};
+    };
+
+    /** @brief Pointer over page */
+    using PagePtr = UniquePtr<Page, Allocator>;
+
+    /** @brief Dense values */
+    using Values = Vector<Type, Allocator, Range>;
+
+    /** @brief Dense sparse indexes */
+    using Indexes = Vector<Range, Allocator, Range>;
+
+
+    /** @brief Get page index of element */
+    [[nodiscard]] static inline Range GetPageIndex(const Range index) noexcept { return index / Range(PageSize); }
+
+    /** @brief Get element index inside page */
+    [[nodiscard]] static inline Range GetElementIndex(const Range index) noexcept { return index % Range(PageSize); }
+
+
+    /** @brief Default destructor */
+    inline ~PackedSparseSet(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline PackedSparseSet(void) noexcept = default;
+
+    /** @brief Default move constructor */
+    inline PackedSparseSet(PackedSparseSet &&other) noexcept = default;
+
+    /** @brief Move assignment */
+    inline PackedSparseSet &operator=(PackedSparseSet &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    inline void swap(PackedSparseSet &other) noexcept
+        { _pages.swap(other._pages); _values.swap(other._values); _indexes.swap(other._indexes); }
+
+
+    /** @brief Get the number of values in the set */
+    [[nodiscard]] inline Range size(void) const noexcept { return _values.size(); }
+
+    /** @brief Check if the set is empty */
+    [[nodiscard]] inline bool empty(void) const noexcept { return _values.empty(); }
+
+    /** @brief Get the number of allocated pages */
+    [[nodiscard]] Range pageCount(void) const noexcept;
+
+    /** @brief Get a page by page index, nullptr if not allocated */
+    [[nodiscard]] inline const Page *page(const Range pageIndex) const noexcept
+        { return pageIndex < _pages.size() ? _pages[pageIndex].get() : nullptr; }
+
+
+    /** @brief Check if a sparse index is in the set */
+    [[nodiscard]] inline bool contains(const Range index) const noexcept { return denseIndex(index) != NullIndex; }
+
+    /** @brief Get the dense index of a sparse index, NullIndex if not in the set */
+    [[nodiscard]] inline Range denseIndex(const Range index) const noexcept;
+
+
+    /** @brief Add a new value to the set, the index must not be in the set */
+    template<typename ...Args>
+    Type &add(const Range index, Args &&...args) noexcept;
+
+    /** @brief Remove a value from the set, the index must be in the set */
+    void remove(const Range index) noexcept;
+
+    /** @brief Extract and remove a value from the set, the index must be in the set */
+    [[nodiscard]] Type extract(const Range index) noexcept;
+
+    /** @brief Remove every value and release pages */
+    void clear(void) noexcept;
+
+    /** @brief Remove every value and release all memory */
+    void release(void) noexcept;
+
+    /** @brief Trim trailing released pages from the page list */
+    void shrinkToFit(void) noexcept;
+
+
+    /** @brief Get value reference by sparse index, the index must be in the set */
+    [[nodiscard]] inline Type &at(const Range index) noexcept { return _values[denseIndexUnsafe(index)]; }
+    [[nodiscard]] inline const Type &at(const Range index) const noexcept { return _values[denseIndexUnsafe(index)]; }
+
+    /** @brief Get value pointer by sparse index, nullptr if not in the set */
+    [[nodiscard]] inline Type *find(const Range index) noexcept
+        { const auto dense = denseIndex(index); return dense != NullIndex ? &_values[dense] : nullptr; }
+    [[nodiscard]] inline const Type *find(const Range index) const noexcept
+        { const auto dense = denseIndex(index); return dense != NullIndex ? &_values[dense] : nullptr; }
+
+
+    /** @brief Dense values iterators */
+    [[nodiscard]] inline Type *begin(void) noexcept { return _values.begin(); }
+    [[nodiscard]] inline Type *end(void) noexcept { return _values.end(); }
+    [[nodiscard]] inline const Type *begin(void) const noexcept { return _values.begin(); }
+    [[nodiscard]] inline const Type *end(void) const noexcept { return _values.end(); }
+
+    /** @brief Get dense values */
+    [[nodiscard]] inline Values &values(void) noexcept { return _values; }
+    [[nodiscard]] inline const Values &values(void) const noexcept { return _values; }
+
+    /** @brief Get dense sparse indexes, 'indexes()[i]' is the sparse index of 'values()[i]' */
+    [[nodiscard]] inline const Indexes &indexes(void) const noexcept { return _indexes; }
+
+private:
+    Vector<PagePtr, Allocator, Range> _pages {};
+    Values _values {};
+    Indexes _indexes {};
+
+    /** @brief Get the dense index of a sparse index that is in the set */
+    [[nodiscard]] inline Range denseIndexUnsafe(const Range index) const noexcept
+        { return _pages[GetPageIndex(index)]->data[GetElementIndex(index)]; }
+
+    /** @brief Get the dense index slot of a sparse index, allocating its page if needed */
+    [[nodiscard]] Range &denseIndexSlot(const Range index) noexcept;
+
+    /** @brief Unlink a sparse index and fill its dense hole with the last value, the value must be already moved or destroyed */
+    void unlink(const Range index, const Range dense) noexcept;
+};
+
+#include "PackedSparseSet.ipp"
\ No newline at end of file
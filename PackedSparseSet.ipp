@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Packed sparse set
+ */
+
+#include <algorithm>
+
+#include "Assert.hpp"
+#include "PackedSparseSet.hpp"
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline Range kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::denseIndex(const Range index) const noexcept
+{
+    const auto pageIndex = GetPageIndex(index);
+
+    if (pageIndex >= _pages.size()) [[unlikely]]
+        return NullIndex;
+    const auto &page = _pages[pageIndex];
+    if (!page) [[unlikely]]
+        return NullIndex;
+    return page->data[GetElementIndex(index)];
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline Range kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::pageCount(void) const noexcept
+{
+    return static_cast<Range>(std::count_if(_pages.begin(), _pages.end(), [](const auto &page) { return static_cast<bool>(page); }));
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline Range &kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::denseIndexSlot(const Range index) noexcept
+{
+    const auto pageIndex = GetPageIndex(index);
+
+    if (const auto size = _pages.size(); pageIndex >= size) [[unlikely]]
+        _pages.insertDefault(_pages.end(), 1 + pageIndex - size);
+
+    auto &page = _pages[pageIndex];
+    if (!page) [[unlikely]] {
+        page = PagePtr::Make();
+        std::fill_n(page->data, PageSize, NullIndex);
+    }
+    return page->data[GetElementIndex(index)];
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+template<typename ...Args>
+inline Type &kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::add(const Range index, Args &&...args) noexcept
+{
+    auto &dense = denseIndexSlot(index);
+
+    kFAssert(dense == NullIndex, "PackedSparseSet::add: Index ", index, " is already in the set");
+    ++_pages[GetPageIndex(index)]->count;
+    dense = _values.size();
+    _indexes.push(index);
+    return _values.push(std::forward<Args>(args)...);
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::unlink(const Range index, const Range dense) noexcept
+{
+    const auto last = _values.size() - 1;
+
+    if (dense != last) {
+        const auto lastIndex = _indexes[last];
+        _values[dense] = std::move(_values[last]);
+        _indexes[dense] = lastIndex;
+        _pages[GetPageIndex(lastIndex)]->data[GetElementIndex(lastIndex)] = dense;
+    }
+    auto &page = _pages[GetPageIndex(index)];
+    page->data[GetElementIndex(index)] = NullIndex;
+    if (!--page->count)
+        page.release();
+    _values.pop();
+    _indexes.pop();
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::remove(const Range index) noexcept
+{
+    kFAssert(contains(index), "PackedSparseSet::remove: Index ", index, " is not in the set");
+    unlink(index, denseIndexUnsafe(index));
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline Type kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::extract(const Range index) noexcept
+{
+    kFAssert(contains(index), "PackedSparseSet::extract: Index ", index, " is not in the set");
+    const auto dense = denseIndexUnsafe(index);
+    Type value(std::move(_values[dense]));
+
+    unlink(index, dense);
+    return value;
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::clear(void) noexcept
+{
+    _values.clear();
+    _indexes.clear();
+    _pages.clear();
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::release(void) noexcept
+{
+    _values.release();
+    _indexes.release();
+    _pages.release();
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range>
+inline void kF::Core::PackedSparseSet<Type, PageSize, Allocator, Range>::shrinkToFit(void) noexcept
+{
+    auto end = _pages.end();
+
+    while (end != _pages.begin() && !*(end - 1))
+        --end;
+    if (end == _pages.begin())
+        _pages.release();
+    else
+        _pages.erase(end, _pages.end());
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel algorithms
+ */
+
+#include "Parallel.hpp"
+
+using namespace kF;
+
+Core::Scheduler<> &Core::SharedScheduler(void) noexcept
+{
+    static Scheduler<> SharedInstance;
+
+    return SharedInstance;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel algorithms
+ */
+
+#pragma once
+
+#include <functional>
+#include <type_traits>
+
+#include "Scheduler.hpp"
+
+namespace kF::Core
+{
+    /** @brief Minimum number of elements processed by a single task when the grain size is deduced */
+    constexpr std::size_t ParallelMinGrainSize = 2048;
+
+    /** @brief Number of chunks desired per participating thread when the grain size is deduced */
+    constexpr std::size_t ParallelChunksPerThread = 8;
+
+
+    /** @brief Get the scheduler shared by parallel algorithms that don't take one */
+    [[nodiscard]] Scheduler<> &SharedScheduler(void) noexcept;
+
+
+    /** @brief Invoke 'callable' on each element of 'range' in parallel
+     *  @param grainSize Minimum number of elements processed by a task, deduced from range size and worker count if null */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Callable>
+    void ParallelFor(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Callable &&callable, const std::size_t grainSize = 0ul) noexcept;
+
+    /** @brief Invoke 'callable' on each element of 'range' in parallel, using the shared scheduler */
+    template<typename Iterator, typename Callable>
+    inline void ParallelFor(const IteratorRange<Iterator> &range, Callable &&callable, const std::size_t grainSize = 0ul) noexcept
+        { ParallelFor(SharedScheduler(), range, std::forward<Callable>(callable), grainSize); }
+
+
+    /** @brief Reduce 'range' in parallel using a single associative operation
+     *  Each chunk is reduced from its first element and partial results are reduced with 'reducer' too,
+     *  so 'reducer(Value, element)' and 'reducer(Value, Value)' must be the same associative operation (sum, min, max, ...)
+     *  Use the overload taking a 'combiner' when the reducer transforms elements (ex: sum of squares)
+     *  @return Reduction of 'init' with every element of 'range' */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Value, typename Reducer>
+    [[nodiscard]] Value ParallelReduce(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Value init, Reducer &&reducer, const std::size_t grainSize = 0ul) noexcept;
+
+    /** @brief Reduce 'range' in parallel using a single associative operation, using the shared scheduler */
+    template<typename Iterator, typename Value, typename Reducer>
+    [[nodiscard]] inline Value ParallelReduce(const IteratorRange<Iterator> &range, Value init, Reducer &&reducer, const std::size_t grainSize = 0ul) noexcept
+        { return ParallelReduce(SharedScheduler(), range, std::move(init), std::forward<Reducer>(reducer), grainSize); }
+
+    /** @brief Reduce 'range' in parallel, folding each chunk with 'reducer' then merging partial results with 'combiner'
+     *  Each chunk is folded from a copy of 'identity', which must be an identity of 'combiner'
+     *  'combiner' must be associative and 'combiner(lhs, fold(identity, chunk))' must equal 'fold(lhs, chunk)'
+     *  @return Fold of 'identity' with every element of 'range', equal to the sequential fold */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Value, typename Reducer, typename Combiner>
+        requires std::is_invocable_r_v<Value, Combiner &, Value, Value>
+    [[nodiscard]] Value ParallelReduce(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Value identity, Reducer &&reducer, Combiner &&combiner, const std::size_t grainSize = 0ul) noexcept;
+
+    /** @brief Reduce 'range' in parallel with a separate 'combiner', using the shared scheduler */
+    template<typename Iterator, typename Value, typename Reducer, typename Combiner>
+        requires std::is_invocable_r_v<Value, Combiner &, Value, Value>
+    [[nodiscard]] inline Value ParallelReduce(const IteratorRange<Iterator> &range, Value identity, Reducer &&reducer, Combiner &&combiner, const std::size_t grainSize = 0ul) noexcept
+        { return ParallelReduce(SharedScheduler(), range, std::move(identity), std::forward<Reducer>(reducer), std::forward<Combiner>(combiner), grainSize); }
+
+
+    /** @brief Store the result of 'callable' over each element of 'range' into 'output' in parallel */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, std::random_access_iterator OutputIterator, typename Callable>
+    void ParallelTransform(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, const OutputIterator output, Callable &&callable, const std::size_t grainSize = 0ul) noexcept;
+
+    /** @brief Store the result of 'callable' over each element of 'range' into 'output' in parallel, using the shared scheduler */
+    template<typename Iterator, std::random_access_iterator OutputIterator, typename Callable>
+    inline void ParallelTransform(const IteratorRange<Iterator> &range, const OutputIterator output, Callable &&callable, const std::size_t grainSize = 0ul) noexcept
+        { ParallelTransform(SharedScheduler(), range, output, std::forward<Callable>(callable), grainSize); }
+
+
+    /** @brief Sort 'range' in parallel (not stable)
+     *  Chunks are sorted independently then merged by pairs, each merge being split into independent sub-merges */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Compare = std::less<>>
+    void ParallelSort(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, const Compare &compare = Compare {}, const std::size_t grainSize = 0ul) noexcept;
+
+    /** @brief Sort 'range' in parallel (not stable), using the shared scheduler */
+    template<typename Iterator, typename Compare = std::less<>>
+    inline void ParallelSort(const IteratorRange<Iterator> &range, const Compare &compare = Compare {}, const std::size_t grainSize = 0ul) noexcept
+        { ParallelSort(SharedScheduler(), range, compare, grainSize); }
+
+
+    namespace Internal
+    {
+        /** @brief Deduce the grain size of a parallel operation */
+        template<kF::Core::StaticAllocatorRequirements Allocator>
+        [[nodiscard]] std::size_t ParallelGrainSize(const Scheduler<Allocator> &scheduler, const std::size_t size, const std::size_t grainSize) noexcept;
+
+        /** @brief Invoke 'callable(chunkIndex, begin, end)' over each chunk of [0, size[ in parallel
+         *  Chunks are claimed dynamically by the calling thread and at most one task per worker
+         *  The calling thread helps executing scheduled tasks until every chunk is done */
+        template<kF::Core::StaticAllocatorRequirements Allocator, typename Callable>
+        void ParallelChunks(Scheduler<Allocator> &scheduler, const std::size_t size, const std::size_t grainSize, Callable &&callable) noexcept;
+
+        /** @brief Find how many elements of 'lhs' are part of the first 'count' elements of the merge of 'lhs' and 'rhs' */
+        template<typename Iterator, typename Compare>
+        [[nodiscard]] std::size_t ParallelMergeRank(const Iterator lhs, const std::size_t lhsSize,
+                const Iterator rhs, const std::size_t rhsSize, const std::size_t count, const Compare &compare) noexcept;
+    }
+}
+
+#include "Parallel.ipp"
\ No newline at end of file
@@ -0,0 +1,259 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel algorithms
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "Abort.hpp"
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Callable>
+inline void kF::Core::ParallelFor(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Callable &&callable, const std::size_t grainSize) noexcept
+{
+    const auto size = range.size();
+
+    Internal::ParallelChunks(scheduler, size, Internal::ParallelGrainSize(scheduler, size, grainSize),
+        [&range, &callable](const std::size_t, const std::size_t begin, const std::size_t end) {
+            for (auto it = range.begin() + begin, last = range.begin() + end; it != last; ++it)
+                callable(*it);
+        }
+    );
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Value, typename Reducer>
+inline Value kF::Core::ParallelReduce(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Value init, Reducer &&reducer, const std::size_t grainSize) noexcept
+{
+    const auto size = range.size();
+    const auto grain = Internal::ParallelGrainSize(scheduler, size, grainSize);
+    const auto chunkCount = (size + grain - 1ul) / grain;
+
+    if (chunkCount <= 1ul) {
+        for (const auto &elem : range)
+            init = reducer(std::move(init), elem);
+        return init;
+    }
+    // Each chunk is reduced from its first element, 'init' is only reduced once
+    HeapArray<Value, Allocator, std::size_t> partials(chunkCount, init);
+    Internal::ParallelChunks(scheduler, size, grain,
+        [&range, &reducer, &partials](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+            auto it = range.begin() + begin;
+            const auto last = range.begin() + end;
+            Value value = *it;
+            while (++it != last)
+                value = reducer(std::move(value), *it);
+            partials[chunk] = std::move(value);
+        }
+    );
+    for (auto &partial : partials)
+        init = reducer(std::move(init), std::move(partial));
+    return init;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Value, typename Reducer, typename Combiner>
+    requires std::is_invocable_r_v<Value, Combiner &, Value, Value>
+inline Value kF::Core::ParallelReduce(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, Value identity, Reducer &&reducer, Combiner &&combiner, const std::size_t grainSize) noexcept
+{
+    const auto size = range.size();
+    const auto grain = Internal::ParallelGrainSize(scheduler, size, grainSize);
+    const auto chunkCount = (size + grain - 1ul) / grain;
+
+    if (chunkCount <= 1ul) {
+        for (const auto &elem : range)
+            identity = reducer(std::move(identity), elem);
+        return identity;
+    }
+    // Each chunk is folded from its own copy of 'identity'
+    HeapArray<Value, Allocator, std::size_t> partials(chunkCount, identity);
+    Internal::ParallelChunks(scheduler, size, grain,
+        [&range, &reducer, &partials](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+            Value value = std::move(partials[chunk]);
+            for (auto it = range.begin() + begin, last = range.begin() + end; it != last; ++it)
+                value = reducer(std::move(value), *it);
+            partials[chunk] = std::move(value);
+        }
+    );
+    for (auto &partial : partials)
+        identity = combiner(std::move(identity), std::move(partial));
+    return identity;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, std::random_access_iterator OutputIterator, typename Callable>
+inline void kF::Core::ParallelTransform(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, const OutputIterator output, Callable &&callable, const std::size_t grainSize) noexcept
+{
+    const auto size = range.size();
+
+    Internal::ParallelChunks(scheduler, size, Internal::ParallelGrainSize(scheduler, size, grainSize),
+        [&range, output, &callable](const std::size_t, const std::size_t begin, const std::size_t end) {
+            std::transform(range.begin() + begin, range.begin() + end, output + begin, callable);
+        }
+    );
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Iterator, typename Compare>
+inline void kF::Core::ParallelSort(Scheduler<Allocator> &scheduler, const IteratorRange<Iterator> &range, const Compare &compare, const std::size_t grainSize) noexcept
+{
+    using Type = typename IteratorRange<Iterator>::Type;
+
+    const auto size = range.size();
+    const auto grain = grainSize ? grainSize : ParallelMinGrainSize;
+    auto runCount = Core::NextPowerOf2(scheduler.workerCount() + 1ul);
+
+    while (runCount > 1ul && size / runCount < grain)
+        runCount /= 2ul;
+    if (runCount <= 1ul) {
+        std::sort(range.begin(), range.end(), compare);
+        return;
+    }
+
+    // Runs are moved into the temporary buffer and sorted there
+    auto * const buffer = reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * size, alignof(Type)));
+    kFEnsure(buffer, "Core::ParallelSort: Allocation of temporary buffer failed");
+    const auto runBegin = [size, runCount](const std::size_t run) { return run * size / runCount; };
+    Internal::ParallelChunks(scheduler, runCount, 1ul,
+        [&range, &compare, buffer, &runBegin](const std::size_t run, const std::size_t, const std::size_t) {
+            const auto begin = runBegin(run);
+            const auto end = runBegin(run + 1ul);
+            std::uninitialized_move(range.begin() + begin, range.begin() + end, buffer + begin);
+            std::sort(buffer + begin, buffer + end, compare);
+        }
+    );
+
+    // Merge pairs of runs, ping-ponging between the buffer and the range
+    // Each merge is split into as many independent sub-merges as it contains runs
+    // Split points are computed before merging as sub-merges move elements out of the source
+    struct Piece
+    {
+        std::size_t lhsBegin {};
+        std::size_t lhsSize {};
+        std::size_t rhsBegin {};
+        std::size_t rhsSize {};
+        std::size_t from {};
+        std::size_t to {};
+        bool isLast {};
+    };
+    HeapArray<std::size_t, Allocator, std::size_t> splits(runCount);
+    const auto mergeRuns = [&scheduler, &compare, &runBegin, &splits, runCount](const auto source, const auto destination, const std::size_t width) {
+        const auto pieceCount = width * 2ul;
+        const auto makePiece = [&runBegin, pieceCount, width](const std::size_t piece) {
+            const auto first = (piece / pieceCount) * pieceCount;
+            const auto subPiece = piece % pieceCount;
+            const auto lhsBegin = runBegin(first);
+            const auto rhsBegin = runBegin(first + width);
+            const auto total = runBegin(first + pieceCount) - lhsBegin;
+            return Piece {
+                .lhsBegin = lhsBegin,
+                .lhsSize = rhsBegin - lhsBegin,
+                .rhsBegin = rhsBegin,
+                .rhsSize = total - (rhsBegin - lhsBegin),
+                .from = subPiece * total / pieceCount,
+                .to = (subPiece + 1ul) * total / pieceCount,
+                .isLast = subPiece == pieceCount - 1ul
+            };
+        };
+        for (auto i = 0ul; i != runCount; ++i) {
+            const auto piece = makePiece(i);
+            splits[i] = Internal::ParallelMergeRank(source + piece.lhsBegin, piece.lhsSize, source + piece.rhsBegin, piece.rhsSize, piece.from, compare);
+        }
+        Internal::ParallelChunks(scheduler, runCount, 1ul,
+            [&compare, &splits, &makePiece, source, destination](const std::size_t i, const std::size_t, const std::size_t) {
+                const auto piece = makePiece(i);
+                const auto lhs = source + piece.lhsBegin;
+                const auto rhs = source + piece.rhsBegin;
+                const auto lhsFrom = splits[i];
+                const auto lhsTo = piece.isLast ? piece.lhsSize : splits[i + 1ul];
+                std::merge(
+                    std::make_move_iterator(lhs + lhsFrom), std::make_move_iterator(lhs + lhsTo),
+                    std::make_move_iterator(rhs + (piece.from - lhsFrom)), std::make_move_iterator(rhs + (piece.to - lhsTo)),
+                    destination + piece.lhsBegin + piece.from,
+                    compare
+                );
+            }
+        );
+    };
+    bool inBuffer = true;
+    for (auto width = 1ul; width < runCount; width *= 2ul) {
+        if (inBuffer)
+            mergeRuns(buffer, range.begin(), width);
+        else
+            mergeRuns(range.begin(), buffer, width);
+        inBuffer = !inBuffer;
+    }
+
+    // Move back the result if needed and release the buffer
+    Internal::ParallelChunks(scheduler, runCount, 1ul,
+        [&range, buffer, &runBegin, inBuffer](const std::size_t run, const std::size_t, const std::size_t) {
+            const auto begin = runBegin(run);
+            const auto end = runBegin(run + 1ul);
+            if (inBuffer)
+                std::move(buffer + begin, buffer + end, range.begin() + begin);
+            std::destroy(buffer + begin, buffer + end);
+        }
+    );
+    Allocator::Deallocate(buffer, sizeof(Type) * size, alignof(Type));
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::Internal::ParallelGrainSize(const Scheduler<Allocator> &scheduler, const std::size_t size, const std::size_t grainSize) noexcept
+{
+    if (grainSize)
+        return grainSize;
+    const auto chunkCount = (scheduler.workerCount() + 1ul) * ParallelChunksPerThread;
+    return std::max((size + chunkCount - 1ul) / chunkCount, ParallelMinGrainSize);
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Callable>
+inline void kF::Core::Internal::ParallelChunks(Scheduler<Allocator> &scheduler, const std::size_t size, const std::size_t grainSize, Callable &&callable) noexcept
+{
+    const auto chunkCount = (size + grainSize - 1ul) / grainSize;
+
+    if (!chunkCount)
+        return;
+    else if (chunkCount == 1ul) {
+        callable(0ul, 0ul, size);
+        return;
+    }
+
+    std::atomic<std::size_t> nextChunk { 0ul };
+    std::atomic<std::size_t> doneTasks { 0ul };
+    const auto work = [&callable, &nextChunk, size, grainSize, chunkCount] {
+        for (auto chunk = nextChunk.fetch_add(1ul, std::memory_order_relaxed); chunk < chunkCount; chunk = nextChunk.fetch_add(1ul, std::memory_order_relaxed)) {
+            const auto begin = chunk * grainSize;
+            callable(chunk, begin, std::min(begin + grainSize, size));
+        }
+    };
+    const auto taskCount = std::min(chunkCount - 1ul, scheduler.workerCount());
+
+    for (auto i = 0ul; i != taskCount; ++i) {
+        scheduler.schedule([&work, &doneTasks] {
+            work();
+            doneTasks.fetch_add(1ul, std::memory_order_release);
+        });
+    }
+    work();
+    // Tasks reference the current stack frame, help the scheduler until all of them are done
+    while (doneTasks.load(std::memory_order_acquire) != taskCount) {
+        if (!scheduler.executeOne())
+            std::this_thread::yield();
+    }
+}
+
+template<typename Iterator, typename Compare>
+inline std::size_t kF::Core::Internal::ParallelMergeRank(const Iterator lhs, const std::size_t lhsSize,
+        const Iterator rhs, const std::size_t rhsSize, const std::size_t count, const Compare &compare) noexcept
+{
+    auto low = count > rhsSize ? count - rhsSize : 0ul;
+    auto high = std::min(count, lhsSize);
+
+    while (low < high) {
+        const auto lhsCount = (low + high) / 2ul;
+        const auto rhsCount = count - lhsCount;
+        // Equal elements of 'lhs' are merged first
+        if (rhsCount && !compare(rhs[rhsCount - 1ul], lhs[lhsCount]))
+            low = lhsCount + 1ul;
+        else
+            high = lhsCount;
+    }
+    return low;
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Queue Instrumentation
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+
+#include "Utils.hpp"
+
+/** @brief Default 'Instrumented' parameter of ring queues (must be the same in every translation unit) */
+#ifndef KUBE_QUEUE_INSTRUMENTATION
+# define KUBE_QUEUE_INSTRUMENTATION false
+#endif
+
+namespace kF::Core
+{
+    struct QueueStatistics;
+
+    template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+    class QueueInstrumentation;
+}
+
+/** @brief Snapshot of the statistics of an instrumented queue */
+struct kF::Core::QueueStatistics
+{
+    /** @brief Log2 of the number of linear sub-buckets per power of two of the latency histogram */
+    static constexpr std::size_t LatencySubBucketShift = 2;
+
+    /** @brief Number of linear sub-buckets per power of two of the latency histogram */
+    static constexpr std::size_t LatencySubBucketCount = 1ul << LatencySubBucketShift;
+
+    /** @brief Number of buckets of the latency histogram, covering the whole 64 bits range */
+    static constexpr std::size_t LatencyBucketCount = (64 - LatencySubBucketShift + 1) * LatencySubBucketCount;
+
+    std::size_t pushFailures { 0 }; // Number of push operations that could not insert all their elements
+    std::size_t highWaterMark { 0 }; // Highest observed number of elements
+    std::size_t latencySamples { 0 }; // Number of sampled elements
+    std::array<std::size_t, LatencyBucketCount> latencyBuckets {}; // Log-linear histogram of sampled latencies in nanoseconds
+
+
+    /** @brief Get the histogram bucket of a latency */
+    [[nodiscard]] static constexpr std::size_t LatencyBucketIndex(const std::uint64_t nanoseconds) noexcept
+    {
+        if (nanoseconds < LatencySubBucketCount)
+            return static_cast<std::size_t>(nanoseconds);
+        const auto exponent = static_cast<std::size_t>(std::bit_width(nanoseconds)) - 1;
+        const auto subBucket = static_cast<std::size_t>(nanoseconds >> (exponent - LatencySubBucketShift)) & (LatencySubBucketCount - 1);
+        return (exponent - LatencySubBucketShift + 1) * LatencySubBucketCount + subBucket;
+    }
+
+    /** @brief Get the lowest latency of a histogram bucket */
+    [[nodiscard]] static constexpr std::uint64_t LatencyBucketLowerBound(const std::size_t index) noexcept
+    {
+        if (index < LatencySubBucketCount)
+            return index;
+        const auto exponent = index / LatencySubBucketCount + LatencySubBucketShift - 1;
+        const auto subBucket = index % LatencySubBucketCount;
+        return static_cast<std::uint64_t>(LatencySubBucketCount + subBucket) << (exponent - LatencySubBucketShift);
+    }
+
+    /** @brief Get the lower bound in nanoseconds of the latency percentile in range [0, 1] */
+    [[nodiscard]] std::uint64_t latencyPercentile(const double percentile) const noexcept
+    {
+        const auto target = static_cast<std::size_t>(percentile * static_cast<double>(latencySamples));
+        std::size_t count = 0;
+
+        for (auto i = 0ul; i != LatencyBucketCount; ++i) {
+            count += latencyBuckets[i];
+            if (count > target || (count && count == latencySamples))
+                return LatencyBucketLowerBound(i);
+        }
+        return 0;
+    }
+};
+
+/**
+ * @brief Instrumentation layer of ring queues, disabled unless its queue is instrumented
+ * Records push failures, the high-water mark and the enqueue-to-dequeue latency of one cell out of 'SampleRate'.
+ * Sampled cells are selected by index, their push timestamp is stored in a side table until they are popped.
+ * Hooks must be called before the cells are published (push) or released (pop) to the other side.
+ *
+ * @tparam Allocator Static allocator of the timestamp table
+ * @tparam Enabled If false, every hook is a no-op and the instance is empty
+ */
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled = KUBE_QUEUE_INSTRUMENTATION>
+class alignas_cacheline kF::Core::QueueInstrumentation
+{
+public:
+    /** @brief Log2 of the sample rate */
+    static constexpr std::size_t SampleShift = 6;
+
+    /** @brief One cell out of 'SampleRate' is sampled */
+    static constexpr std::size_t SampleRate = 1ul << SampleShift;
+
+
+    /** @brief Release the timestamp table */
+    ~QueueInstrumentation(void) noexcept;
+
+    /** @brief Construct the instrumentation of a queue of 'cellCount' cells */
+    QueueInstrumentation(const std::size_t cellCount) noexcept;
+
+
+    /** @brief Record a push operation that could not insert all its elements */
+    inline void onPushFailure(void) noexcept { _pushFailures.fetch_add(1, std::memory_order_relaxed); }
+
+    /** @brief Record the push of 'count' cells starting at 'cell', 'sizeFunctor' returns the number of elements after the push */
+    template<typename SizeFunctor>
+    void onPush(const std::size_t cell, const std::size_t count, SizeFunctor &&sizeFunctor) noexcept;
+
+    /** @brief Record the pop of 'count' cells starting at 'cell' */
+    void onPop(const std::size_t cell, const std::size_t count) noexcept;
+
+
+    /** @brief Get a snapshot of the statistics */
+    [[nodiscard]] QueueStatistics snapshot(void) const noexcept;
+
+    /** @brief Reset the statistics */
+    void reset(void) noexcept;
+
+
+private:
+    std::atomic<std::size_t> _pushFailures { 0 };
+    std::atomic<std::size_t> _highWaterMark { 0 };
+    std::array<std::atomic<std::size_t>, QueueStatistics::LatencyBucketCount> _latencyBuckets {};
+    std::atomic<std::uint64_t> *_timestamps {};
+    std::size_t _cellCount { 0 };
+
+
+    /** @brief Copy and move constructors disabled */
+    QueueInstrumentation(const QueueInstrumentation &other) = delete;
+    QueueInstrumentation(QueueInstrumentation &&other) = delete;
+
+
+    /** @brief Call 'functor' with the index of each sampled cell in range [cell, cell + count[ */
+    template<typename Functor>
+    void forEachSampledCell(const std::size_t cell, const std::size_t count, Functor &&functor) const noexcept;
+
+    /** @brief Get the current timestamp in nanoseconds */
+    [[nodiscard]] static inline std::uint64_t Now(void) noexcept
+        { return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+};
+
+/** @brief Disabled instrumentation */
+template<kF::Core::StaticAllocatorRequirements Allocator>
+class kF::Core::QueueInstrumentation<Allocator, false>
+{
+public:
+    /** @brief Construct the instrumentation of a queue of 'cellCount' cells */
+    inline QueueInstrumentation(const std::size_t) noexcept {}
+
+    /** @brief No-op */
+    inline void onPushFailure(void) noexcept {}
+
+    /** @brief No-op */
+    template<typename SizeFunctor>
+    inline void onPush(const std::size_t, const std::size_t, SizeFunctor &&) noexcept {}
+
+    /** @brief No-op */
+    inline void onPop(const std::size_t, const std::size_t) noexcept {}
+
+    /** @brief Get an empty snapshot */
+    [[nodiscard]] inline QueueStatistics snapshot(void) const noexcept { return QueueStatistics {}; }
+
+    /** @brief No-op */
+    inline void reset(void) noexcept {}
+};
+
+#include "QueueInstrumentation.ipp"
\ No newline at end of file
@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Queue Instrumentation
+ */
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+inline kF::Core::QueueInstrumentation<Allocator, Enabled>::~QueueInstrumentation(void) noexcept
+{
+    Allocator::Deallocate(_timestamps, sizeof(std::atomic<std::uint64_t>) * ((_cellCount >> SampleShift) + 1), alignof(std::atomic<std::uint64_t>));
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+inline kF::Core::QueueInstrumentation<Allocator, Enabled>::QueueInstrumentation(const std::size_t cellCount) noexcept
+    : _cellCount(cellCount)
+{
+    const auto timestampCount = (cellCount >> SampleShift) + 1;
+
+    _timestamps = reinterpret_cast<std::atomic<std::uint64_t> *>(
+        Allocator::Allocate(sizeof(std::atomic<std::uint64_t>) * timestampCount, alignof(std::atomic<std::uint64_t>))
+    );
+    for (auto i = 0ul; i != timestampCount; ++i)
+        new (_timestamps + i) std::atomic<std::uint64_t>(0);
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+template<typename SizeFunctor>
+inline void kF::Core::QueueInstrumentation<Allocator, Enabled>::onPush(const std::size_t cell, const std::size_t count, SizeFunctor &&sizeFunctor) noexcept
+{
+    const auto size = sizeFunctor();
+    auto highWaterMark = _highWaterMark.load(std::memory_order_relaxed);
+
+    while (size > highWaterMark && !_highWaterMark.compare_exchange_weak(highWaterMark, size, std::memory_order_relaxed));
+    forEachSampledCell(cell, count, [this, now = std::uint64_t {}](const std::size_t sampledCell) mutable {
+        if (!now)
+            now = Now();
+        _timestamps[sampledCell >> SampleShift].store(now, std::memory_order_relaxed);
+    });
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+inline void kF::Core::QueueInstrumentation<Allocator, Enabled>::onPop(const std::size_t cell, const std::size_t count) noexcept
+{
+    forEachSampledCell(cell, count, [this, now = std::uint64_t {}](const std::size_t sampledCell) mutable {
+        if (!now)
+            now = Now();
+        const auto timestamp = _timestamps[sampledCell >> SampleShift].load(std::memory_order_relaxed);
+        const auto latency = now > timestamp ? now - timestamp : 0;
+        _latencyBuckets[QueueStatistics::LatencyBucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+    });
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+template<typename Functor>
+inline void kF::Core::QueueInstrumentation<Allocator, Enabled>::forEachSampledCell(const std::size_t cell, const std::size_t count, Functor &&functor) const noexcept
+{
+    constexpr auto SampleMask = SampleRate - 1;
+
+    // Fast path of single element operations
+    if (count == 1) [[likely]] {
+        if (!(cell & SampleMask)) [[unlikely]]
+            functor(cell);
+        return;
+    }
+    // Ranges may wrap around the end of the queue
+    const auto end = cell + count;
+    const auto firstEnd = std::min(end, _cellCount);
+    for (auto sampledCell = (cell + SampleMask) & ~SampleMask; sampledCell < firstEnd; sampledCell += SampleRate)
+        functor(sampledCell);
+    for (auto sampledCell = 0ul; sampledCell < end - firstEnd; sampledCell += SampleRate)
+        functor(sampledCell);
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+inline kF::Core::QueueStatistics kF::Core::QueueInstrumentation<Allocator, Enabled>::snapshot(void) const noexcept
+{
+    QueueStatistics statistics;
+
+    statistics.pushFailures = _pushFailures.load(std::memory_order_relaxed);
+    statistics.highWaterMark = _highWaterMark.load(std::memory_order_relaxed);
+    statistics.latencySamples = 0;
+    // Samples are counted from the histogram to keep the snapshot consistent
+    for (auto i = 0ul; i != QueueStatistics::LatencyBucketCount; ++i) {
+        statistics.latencyBuckets[i] = _latencyBuckets[i].load(std::memory_order_relaxed);
+        statistics.latencySamples += statistics.latencyBuckets[i];
+    }
+    return statistics;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator, bool Enabled>
+inline void kF::Core::QueueInstrumentation<Allocator, Enabled>::reset(void) noexcept
+{
+    _pushFailures.store(0, std::memory_order_relaxed);
+    _highWaterMark.store(0, std::memory_order_relaxed);
+    for (auto &bucket : _latencyBuckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Queued Dispatcher
+ */
+
+#pragma once
+
+#include "Functor.hpp"
+#include "QueuedDispatcherDetails.hpp"
+
+namespace kF::Core
+{
+    /** @brief Specialization of queued dispatcher with 'Functor' */
+    template<
+        typename Signature,
+        StaticAllocatorRequirements Allocator = DefaultStaticAllocator,
+        std::size_t DesiredSize = CacheLineHalfSize
+    >
+    using QueuedDispatcher = QueuedDispatcherDetails<Signature, Functor<Signature, Allocator, DesiredSize>, Allocator>;
+}
\ No newline at end of file
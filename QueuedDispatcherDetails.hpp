@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Queued Dispatcher
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include "Assert.hpp"
+#include "MPSCQueue.hpp"
+#include "RemovableDispatcherDetails.hpp"
+
+namespace kF::Core
+{
+    template<typename Signature, FunctorRequirements InternalFunctor, StaticAllocatorRequirements Allocator>
+    class QueuedDispatcherDetails;
+}
+
+/**
+ * @brief Event dispatcher that runs its functors on the thread that owns it
+ * Any thread may post an event, its arguments are stored by value into the mailbox of the dispatcher (a MPSC queue).
+ * The owner thread processes the mailbox in batches, dispatching each event in place without extra copy.
+ * Slots must be added, removed and processed by the owner thread only.
+ */
+template<typename Return, typename... Args, kF::Core::FunctorRequirements InternalFunctor, kF::Core::StaticAllocatorRequirements Allocator>
+class kF::Core::QueuedDispatcherDetails<Return(Args...), InternalFunctor, Allocator>
+{
+public:
+    /** @brief Functor type */
+    using Functor = InternalFunctor;
+
+    /** @brief Underlying dispatcher */
+    using Dispatcher = RemovableDispatcherDetails<Return(Args...), InternalFunctor, Allocator>;
+
+    /** @brief Arguments stored by value inside the mailbox */
+    using ArgsTuple = std::tuple<std::remove_cvref_t<Args>...>;
+
+    /** @brief Mailbox of posted events */
+    using Mailbox = MPSCQueue<ArgsTuple, Allocator>;
+
+
+    /** @brief Destructor, pending events are discarded */
+    inline ~QueuedDispatcherDetails(void) noexcept = default;
+
+    /** @brief Construct the dispatcher with a mailbox able to hold 'mailboxCapacity' pending events */
+    inline QueuedDispatcherDetails(const std::size_t mailboxCapacity) noexcept : _mailbox(mailboxCapacity) {}
+
+
+    /** @brief Internal functor count */
+    [[nodiscard]] inline auto count(void) const noexcept { return _dispatcher.count(); }
+
+    /** @brief Get the number of events waiting to be processed */
+    [[nodiscard]] inline std::size_t pendingCount(void) const noexcept { return _mailbox.size(); }
+
+
+    /** @brief Add a functor to dispatch list */
+    template<typename Functor>
+    [[nodiscard]] inline DispatcherSlot add(Functor &&functor) noexcept
+        { return _dispatcher.add(std::forward<Functor>(functor)); }
+
+    /** @brief Add a member function to dispatch list */
+    template<auto MemberFunction, typename ClassType>
+    [[nodiscard]] inline DispatcherSlot add(ClassType &&classType) noexcept
+        { return _dispatcher.template add<MemberFunction>(std::forward<ClassType>(classType)); }
+
+    /** @brief Add a free function to dispatch list */
+    template<auto FreeFunction>
+    [[nodiscard]] inline DispatcherSlot add(void) noexcept
+        { return _dispatcher.template add<FreeFunction>(); }
+
+
+    /** @brief Post an event to be dispatched by the owner thread, thread-safe
+     *  @return false if the mailbox is full */
+    [[nodiscard]] inline bool post(Args ...args) noexcept
+        { return _mailbox.push(std::forward<Args>(args)...); }
+
+    /** @brief Dispatch every internal functors immediately on the calling (owner) thread */
+    inline void dispatch(Args ...args) const noexcept
+        { _dispatcher.dispatch(std::forward<Args>(args)...); }
+
+    /** @brief Dispatch up to 'maxCount' posted events on the calling (owner) thread
+     *  Events are released after being dispatched, so this must not be called from a dispatched functor
+     *  @return Number of processed events */
+    inline std::size_t process(const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept
+    {
+        std::size_t processed = 0;
+
+        kFAssert(!_processing, "Core::QueuedDispatcher::process: Re-entrant call from a dispatched functor");
+        _processing = true;
+        while (processed != maxCount) {
+            const auto batch = _mailbox.peekRange(maxCount - processed);
+            if (batch.empty())
+                break;
+            for (auto &args : batch) {
+                std::apply([this](auto &...values) {
+                    _dispatcher.dispatch(std::forward<Args>(values)...);
+                }, args);
+            }
+            _mailbox.release(batch.size());
+            processed += batch.size();
+        }
+        _processing = false;
+        return processed;
+    }
+
+private:
+    Mailbox _mailbox;
+    Dispatcher _dispatcher {};
+    bool _processing { false };
+
+    /** @brief Copy and move constructors disabled */
+    QueuedDispatcherDetails(const QueuedDispatcherDetails &other) = delete;
+    QueuedDispatcherDetails(QueuedDispatcherDetails &&other) = delete;
+};
\ No newline at end of file
@@ -0,0 +1,153 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Record Queue Details
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TupleUtils.hpp"
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+    class RecordQueueDetails;
+}
+
+/**
+ * @brief Implementation details of bounded record queues
+ * The queue is a ring of blocks storing heterogeneous records inline, removing the need to box each message.
+ * Each record is a header block holding its type index and block count, followed by the record itself.
+ * Records are never split: when a record does not fit before the end of the ring, the remaining blocks are skipped
+ * using a padding record and the record is constructed at the beginning of the ring.
+ * The consumer visits records with a visitor callable with each type of 'Types'.
+ *
+ * @tparam Types std::tuple of the record types that can be inserted
+ * @tparam Allocator Static allocator
+ * @tparam MultipleProducers If true, multiple threads may emplace concurrently
+ */
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+class alignas_double_cacheline kF::Core::Internal::RecordQueueDetails
+{
+public:
+    /** @brief Record header stored in the first block of each record */
+    struct Header
+    {
+        std::uint32_t blockCount { 0 };
+        std::uint32_t typeIndex { 0 };
+    };
+
+    /** @brief Size of a block, large enough to hold a header and to align any record type */
+    static constexpr std::size_t BlockSize = []<typename ...Elems>(std::type_identity<std::tuple<Elems...>>) {
+        return std::max({ sizeof(Header), alignof(Elems)... });
+    }(std::type_identity<Types> {});
+
+    /** @brief Storage unit of the ring */
+    struct alignas(BlockSize) Block
+    {
+        std::byte data[BlockSize];
+    };
+
+    /** @brief Type index of padding records */
+    static constexpr std::uint32_t PaddingIndex = ~static_cast<std::uint32_t>(0);
+
+    /** @brief Number of blocks used by a record of a given type */
+    template<typename Type>
+    static constexpr std::size_t RecordBlockCount = 1 + (sizeof(Type) + BlockSize - 1) / BlockSize;
+
+    /** @brief Buffer structure containing all blocks */
+    struct Buffer
+    {
+        Block *data {};
+        std::size_t capacity { 0 };
+    };
+
+    /** @brief Local thread cache */
+    struct ConsumerCache
+    {
+        Buffer buffer {};
+        std::size_t value { 0 };
+    };
+
+    /** @brief Producer cache, shared between producers if 'MultipleProducers' is true */
+    struct ProducerCache
+    {
+        Buffer buffer {};
+        std::conditional_t<MultipleProducers, std::atomic<std::size_t>, std::size_t> value { 0 };
+    };
+
+
+    /** @brief Destruct and release all memory (unsafe) */
+    ~RecordQueueDetails(void) noexcept;
+
+    /** @brief Default constructor initialize the queue with at least 'byteCapacity' bytes of blocks */
+    RecordQueueDetails(const std::size_t byteCapacity) noexcept;
+
+
+    /** @brief Construct a record of 'Type' into the queue
+     *  @return true if the record has been inserted */
+    template<typename Type, typename ...Args>
+    [[nodiscard]] bool emplace(Args &&...args) noexcept;
+
+
+    /** @brief Visit and destroy up to 'maxCount' records, the visitor is called with a reference to each record
+     *  @return The number of visited records */
+    template<typename Visitor>
+    std::size_t consume(Visitor &&visitor, const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept;
+
+    /** @brief Visit and destroy a single record
+     *  @return true if a record has been visited */
+    template<typename Visitor>
+    [[nodiscard]] inline bool pop(Visitor &&visitor) noexcept
+        { return consume(std::forward<Visitor>(visitor), 1); }
+
+
+    /** @brief Clear all records of the queue (unsafe) */
+    inline void clear(void) noexcept { consume([](auto &) {}); }
+
+
+    /** @brief Get the number of blocks of the ring (one block is always kept unused) */
+    [[nodiscard]] inline std::size_t blockCapacity(void) const noexcept { return _headCache.buffer.capacity; }
+
+
+private:
+    /** @brief Blocks claimed by a producer */
+    struct Claim
+    {
+        std::size_t tail { 0 };
+        std::size_t record { 0 };
+        std::size_t next { 0 };
+    };
+
+    alignas_cacheline std::atomic<size_t> _tail { 0 }; // Tail accessed by both producer and consumer threads
+    alignas_cacheline ProducerCache _tailCache {}; // Cache accessed by producer threads
+
+    alignas_cacheline std::atomic<size_t> _head { 0 }; // Head accessed by both producer and consumer threads
+    alignas_cacheline ConsumerCache _headCache {}; // Cache accessed by consumer thread
+
+
+    /** @brief Copy and move constructors disabled */
+    RecordQueueDetails(const RecordQueueDetails &other) = delete;
+    RecordQueueDetails(RecordQueueDetails &&other) = delete;
+
+
+    /** @brief Claim 'blockCount' contiguous blocks */
+    [[nodiscard]] bool claim(const std::size_t blockCount, Claim &claim) noexcept;
+
+    /** @brief Publish claimed blocks to the consumer */
+    void publish(const Claim &claim) noexcept;
+
+    /** @brief Compute the claim of 'blockCount' contiguous blocks using 'tail' and 'head' */
+    [[nodiscard]] static bool ComputeClaim(const std::size_t tail, const std::size_t head,
+            const std::size_t capacity, const std::size_t blockCount, Claim &claim) noexcept;
+
+    /** @brief Visit then destroy the record of type index 'typeIndex' */
+    template<typename Visitor>
+    static void VisitRecord(const std::uint32_t typeIndex, Block * const data, Visitor &visitor) noexcept;
+};
+
+#include "RecordQueueDetails.ipp"
\ No newline at end of file
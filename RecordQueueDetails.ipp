@@ -0,0 +1,153 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Record Queue Details
+ */
+
+#include <new>
+
+#include "Assert.hpp"
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+inline kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::~RecordQueueDetails(void) noexcept
+{
+    clear();
+    Allocator::Deallocate(_headCache.buffer.data, sizeof(Block) * _headCache.buffer.capacity, alignof(Block));
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+inline kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::RecordQueueDetails(const std::size_t byteCapacity) noexcept
+{
+    _tailCache.buffer.capacity = (byteCapacity + BlockSize - 1) / BlockSize + 1;
+    _tailCache.buffer.data = reinterpret_cast<Block *>(Allocator::Allocate(sizeof(Block) * _tailCache.buffer.capacity, alignof(Block)));
+    _headCache.buffer = _tailCache.buffer;
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+template<typename Type, typename ...Args>
+inline bool kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::emplace(Args &&...args) noexcept
+{
+    constexpr auto BlockCount = RecordBlockCount<Type>;
+    constexpr auto TypeIndex = TupleElementIndex<Type, Types, std::uint32_t>;
+
+    kFAssert(BlockCount < _tailCache.buffer.capacity,
+        "Core::RecordQueue::emplace: Record is larger than the queue");
+    Claim claim;
+    if (!this->claim(BlockCount, claim)) [[unlikely]]
+        return false;
+    auto * const data = _tailCache.buffer.data;
+    if (claim.record != claim.tail) [[unlikely]]
+        new (data + claim.tail) Header { 0, PaddingIndex };
+    new (data + claim.record) Header { static_cast<std::uint32_t>(BlockCount), TypeIndex };
+    new (data + claim.record + 1) Type(std::forward<Args>(args)...);
+    publish(claim);
+    return true;
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+template<typename Visitor>
+inline std::size_t kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::consume(Visitor &&visitor, const std::size_t maxCount) noexcept
+{
+    auto * const data = _headCache.buffer.data;
+    const auto capacity = _headCache.buffer.capacity;
+    auto head = _head.load(std::memory_order_relaxed);
+    auto tail = _headCache.value;
+    std::size_t count = 0;
+
+    while (count != maxCount) {
+        if (head == tail) [[unlikely]] {
+            tail = _headCache.value = _tail.load(std::memory_order_acquire);
+            if (head == tail) [[unlikely]]
+                break;
+        }
+        const auto header = *std::launder(reinterpret_cast<const Header *>(data + head));
+        // Padding always extends to the end of the ring and is published along with the next record
+        if (header.typeIndex == PaddingIndex) [[unlikely]] {
+            head = 0;
+            continue;
+        }
+        VisitRecord(header.typeIndex, data + head + 1, visitor);
+        head += header.blockCount;
+        if (head == capacity) [[unlikely]]
+            head = 0;
+        ++count;
+    }
+    if (count) [[likely]]
+        _head.store(head, std::memory_order_release);
+    return count;
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+inline bool kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::claim(const std::size_t blockCount, Claim &claim) noexcept
+{
+    const auto capacity = _tailCache.buffer.capacity;
+
+    if constexpr (MultipleProducers) {
+        auto tail = _tailCache.value.load(std::memory_order_acquire);
+        while (true) {
+            const auto head = _head.load(std::memory_order_acquire);
+            if (!ComputeClaim(tail, head, capacity, blockCount, claim)) [[unlikely]]
+                return false;
+            // Try to set the tail value shared to producers to preserve blocks during construction
+            else if (_tailCache.value.compare_exchange_weak(tail, claim.next, std::memory_order_acq_rel)) [[likely]]
+                return true;
+        }
+    } else {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        if (ComputeClaim(tail, _tailCache.value, capacity, blockCount, claim)) [[likely]]
+            return true;
+        _tailCache.value = _head.load(std::memory_order_acquire);
+        return ComputeClaim(tail, _tailCache.value, capacity, blockCount, claim);
+    }
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+inline void kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::publish(const Claim &claim) noexcept
+{
+    if constexpr (MultipleProducers) {
+        // Loop while the transaction is not done (may wait prior thread with longer insertion)
+        auto expected = claim.tail;
+        while (!_tail.compare_exchange_weak(expected, claim.next, std::memory_order_acq_rel)) [[unlikely]]
+            expected = claim.tail;
+    } else
+        _tail.store(claim.next, std::memory_order_release);
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+inline bool kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::ComputeClaim(
+        const std::size_t tail, const std::size_t head, const std::size_t capacity, const std::size_t blockCount, Claim &claim) noexcept
+{
+    claim.tail = tail;
+    if (head > tail) {
+        // Free blocks are contiguous up to the block preceding head
+        if (blockCount >= head - tail) [[unlikely]]
+            return false;
+        claim.record = tail;
+    } else if (blockCount <= capacity - tail - !head) [[likely]] {
+        // Free blocks are contiguous up to the end of the ring
+        claim.record = tail;
+    } else if (blockCount < head) {
+        // Skip the end of the ring with a padding record
+        claim.record = 0;
+    } else [[unlikely]]
+        return false;
+    claim.next = claim.record + blockCount;
+    if (claim.next == capacity) [[unlikely]]
+        claim.next = 0;
+    return true;
+}
+
+template<typename Types, kF::Core::StaticAllocatorRequirements Allocator, bool MultipleProducers>
+template<typename Visitor>
+inline void kF::Core::Internal::RecordQueueDetails<Types, Allocator, MultipleProducers>::VisitRecord(
+        const std::uint32_t typeIndex, Block * const data, Visitor &visitor) noexcept
+{
+    [typeIndex, data, &visitor]<typename ...Elems>(std::type_identity<std::tuple<Elems...>>) {
+        const auto visit = [data, &visitor]<typename Elem>(std::type_identity<Elem>) {
+            auto &record = *std::launder(reinterpret_cast<Elem *>(data));
+            visitor(record);
+            record.~Elem();
+            return true;
+        };
+        static_cast<void>(((typeIndex == TupleElementIndex<Elems, Types, std::uint32_t> && visit(std::type_identity<Elems> {})) || ...));
+    }(std::type_identity<Types> {});
+}
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "Vector.hpp"
 #include "SharedPtr.hpp"
 #include "DispatcherSlot.hpp"
+#include "DispatcherGroups.hpp"
 
 namespace kF::Core
 {
@@ -16,7 +17,9 @@ namespace kF::Core
     class RemovableDispatcherDetails;
 }
 
-/** @brief Fast event dispatcher */
+/** @brief Fast event dispatcher with removable slots
+ *  Functors are grouped by invoke function, thus dispatch order is not insertion order
+ *  Slots may be added or removed while dispatching, functors added during a dispatch are only called by the next one */
 template<typename Return, typename... Args, kF::Core::FunctorRequirements InternalFunctor, kF::Core::StaticAllocatorRequirements Allocator>
 class alignas_eighth_cacheline kF::Core::RemovableDispatcherDetails<Return(Args...), InternalFunctor, Allocator>
 {
@@ -30,21 +33,120 @@ public:
     /** @brief Functor handle */
     using ArgsTuple = std::tuple<Args...>;
 
-    /** @brief Removable dispatcher instance */
+    /** @brief Functor groups */
+    using Groups = Internal::DispatcherGroups<decltype(std::declval<const InternalFunctor &>().invoker()), Allocator>;
+
+    /** @brief Functor position */
+    using Range = typename Groups::Range;
+
+    /** @brief Removable dispatcher instance
+     *  Functors are kept dense and grouped by invoke function, handles are translated into positions
+     *  While dispatching, removed functors are released in place and inserted ones are kept aside,
+     *  both are applied once the outermost dispatch returns */
     struct alignas_half_cacheline Instance
     {
-        // @todo make a single allocation removable dispatcher
+        /** @brief Position flag of functors inserted while dispatching, the other bits index the pending list */
+        static constexpr Range PendingFlag = Range(1) << (sizeof(Range) * 8 - 1);
+
         Vector<InternalFunctor, Allocator> functors {};
+        Vector<Handle, Allocator> handles {};
+        Vector<Range, Allocator> positions {};
         Vector<Handle, Allocator> freeList {};
+        Groups groups {};
+        Vector<InternalFunctor, Allocator> pendingFunctors {};
+        Vector<Handle, Allocator> pendingHandles {};
+        Vector<Handle, Allocator> pendingRemovals {};
+        std::uint32_t dispatchDepth {};
+
 
+        /** @brief Get the number of live functors */
+        [[nodiscard]] inline Range count(void) const noexcept
+        {
+            Range count = functors.size() - pendingRemovals.size();
+            for (const auto &functor : pendingFunctors)
+                count += static_cast<bool>(functor);
+            return count;
+        }
+
+        /** @brief Insert a prepared functor and return its handle */
+        [[nodiscard]] inline Handle insert(InternalFunctor &&functor) noexcept
+        {
+            Handle handle;
+            if (!freeList.empty()) {
+                handle = freeList.back();
+                freeList.pop();
+            } else {
+                positions.push();
+                handle = positions.size();
+            }
+            if (dispatchDepth) {
+                positions[handle - 1u] = PendingFlag | pendingFunctors.size();
+                pendingFunctors.push(std::move(functor));
+                pendingHandles.push(handle);
+            } else
+                place(std::move(functor), handle);
+            return handle;
+        }
 
         /** @brief Remove a slot from its handle */
         inline void remove(const Handle handle) noexcept
         {
             kFAssert(handle, "RemovableDispatcherDetails::remove: Can't remove null handle");
-            const auto index = handle - 1u;
-            functors[index].release();
-            freeList.push(index);
+            const auto position = positions[handle - 1u];
+            if (position & PendingFlag) {
+                // The handle is recycled once pending functors are placed
+                pendingFunctors[position & ~PendingFlag].release();
+            } else if (dispatchDepth) {
+                functors[position].release();
+                pendingRemovals.push(handle);
+            } else
+                erase(handle);
+        }
+
+        /** @brief Apply removals and insertions delayed by a dispatch */
+        inline void flush(void) noexcept
+        {
+            for (Range i = 0; i != pendingRemovals.size(); ++i)
+                erase(pendingRemovals[i]);
+            pendingRemovals.clear();
+            for (Range i = 0; i != pendingFunctors.size(); ++i) {
+                if (pendingFunctors[i])
+                    place(std::move(pendingFunctors[i]), pendingHandles[i]);
+                else
+                    freeList.push(pendingHandles[i]);
+            }
+            pendingFunctors.clear();
+            pendingHandles.clear();
+        }
+
+        /** @brief Place a functor at the end of its group */
+        inline void place(InternalFunctor &&functor, const Handle handle) noexcept
+        {
+            functors.push();
+            handles.push();
+            const auto position = groups.insert(functor.invoker(), [this](const Range from, const Range to) { move(from, to); });
+            functors[position] = std::move(functor);
+            handles[position] = handle;
+            positions[handle - 1u] = position;
+        }
+
+        /** @brief Erase a placed functor from its handle */
+        inline void erase(const Handle handle) noexcept
+        {
+            // Releasing may run destructors that remove other slots, the position is read afterward
+            functors[positions[handle - 1u]].release();
+            groups.erase(positions[handle - 1u], [this](const Range from, const Range to) { move(from, to); });
+            functors.pop();
+            handles.pop();
+            freeList.push(handle);
+        }
+
+        /** @brief Move a functor into a free position */
+        inline void move(const Range from, const Range to) noexcept
+        {
+            functors[to] = std::move(functors[from]);
+            handles[to] = handles[from];
+            positions[handles[to] - 1u] = to;
         }
     };
 
@@ -67,74 +169,53 @@ public:
 
 
     /** @brief Internal functor count */
-    [[nodiscard]] inline auto count(void) const noexcept { return _sharedInstance->functors.size() - _sharedInstance->freeList.size(); }
+    [[nodiscard]] inline auto count(void) const noexcept { return _sharedInstance->count(); }
 
 
     /** @brief Add a functor to dispatch list */
     template<typename Functor>
     [[nodiscard]] inline DispatcherSlot add(Functor &&functor) noexcept
     {
-        auto &instance = *_sharedInstance;
-        InternalFunctor *internal;
-        Handle index;
-        if (!instance.freeList.empty()) {
-            index = instance.freeList.back();
-            instance.freeList.pop();
-            internal = &instance.functors[index];
-        } else {
-            index = instance.functors.size();
-            internal = &instance.functors.push();
-        }
-        internal->prepare(std::forward<Functor>(functor));
-        return makeDispatcherSlot(index + 1);
+        InternalFunctor internal;
+        internal.prepare(std::forward<Functor>(functor));
+        return makeDispatcherSlot(_sharedInstance->insert(std::move(internal)));
     }
 
     /** @brief Add a member function to dispatch list */
     template<auto MemberFunction, typename ClassType>
     [[nodiscard]] inline DispatcherSlot add(ClassType &&classType) noexcept
     {
-        auto &instance = *_sharedInstance;
-        InternalFunctor *functor;
-        Handle index;
-        if (!instance.freeList.empty()) {
-            index = instance.freeList.back();
-            instance.freeList.pop();
-            functor = &instance.functors[index];
-        } else {
-            index = instance.functors.size();
-            functor = &instance.functors.push();
-        }
-        functor->template prepare<MemberFunction>(std::forward<ClassType>(classType));
-        return makeDispatcherSlot(index + 1);
+        InternalFunctor internal;
+        internal.template prepare<MemberFunction>(std::forward<ClassType>(classType));
+        return makeDispatcherSlot(_sharedInstance->insert(std::move(internal)));
     }
 
     /** @brief Add a free function to dispatch list */
     template<auto FreeFunction>
     [[nodiscard]] inline DispatcherSlot add(void) noexcept
     {
-        auto &instance = *_sharedInstance;
-        InternalFunctor *functor;
-        Handle index;
-        if (!instance.freeList.empty()) {
-            index = instance.freeList.back() - 1;
-            instance.freeList.pop();
-            functor = &instance.functors[index];
-        } else {
-            index = instance.functors.size();
-            functor = &instance.functors.push();
-        }
-        functor->template prepare<FreeFunction>();
-        return makeDispatcherSlot(index + 1);
+        InternalFunctor internal;
+        internal.template prepare<FreeFunction>();
+        return makeDispatcherSlot(_sharedInstance->insert(std::move(internal)));
     }
 
 
     /** @brief Dispatch every internal functors */
     inline void dispatch(Args ...args) const noexcept
     {
-        for (auto &functor : _sharedInstance->functors) {
-            if (functor)
-                functor(std::forward<Args>(args)...);
+        auto &instance = *_sharedInstance;
+        const auto functors = instance.functors.begin();
+        ++instance.dispatchDepth;
+        for (const auto &group : instance.groups) {
+            const auto invoke = group.key;
+            for (auto i = group.begin; i != group.end; ++i) {
+                // Skip functors removed during this dispatch
+                if (functors[i])
+                    functors[i].invokeWith(invoke, std::forward<Args>(args)...);
+            }
         }
+        if (!--instance.dispatchDepth)
+            instance.flush();
     }
 
     /** @brief Dispatch every internal functors with a given callback to receive the return value of each functor */
@@ -142,10 +223,18 @@ public:
         requires (!std::is_same_v<Return, void> && std::invocable<Callback, Return>)
     inline void dispatch(Callback &&callback, Args ...args) const noexcept
     {
-        for (auto &functor : _sharedInstance->functors) {
-            if (functor)
-                callback(functor(std::forward<Args>(args)...));
+        auto &instance = *_sharedInstance;
+        const auto functors = instance.functors.begin();
+        ++instance.dispatchDepth;
+        for (const auto &group : instance.groups) {
+            const auto invoke = group.key;
+            for (auto i = group.begin; i != group.end; ++i) {
+                if (functors[i])
+                    callback(functors[i].invokeWith(invoke, std::forward<Args>(args)...));
+            }
         }
+        if (!--instance.dispatchDepth)
+            instance.flush();
     }
 
 private:
@@ -170,5 +259,6 @@ private:
     }
 
 
-    SharedInstance _sharedInstance { SharedInstance::Make() };
+    // Mutable as dispatching delays modifications of the shared instance
+    mutable SharedInstance _sharedInstance { SharedInstance::Make() };
 };
\ No newline at end of file
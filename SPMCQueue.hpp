@@ -10,11 +10,12 @@
 #include <memory>
 #include <algorithm>
 
+#include "QueueInstrumentation.hpp"
 #include "Utils.hpp"
 
 namespace kF::Core
 {
-    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
     class SPMCQueue;
 }
 
@@ -24,8 +25,9 @@ namespace kF::Core
  *
  * @tparam Type to be inserted
  * @tparam Allocator Static allocator
+ * @tparam Instrumented If true, the queue records statistics (defaults to 'KUBE_QUEUE_INSTRUMENTATION')
  */
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, bool Instrumented = KUBE_QUEUE_INSTRUMENTATION>
 class alignas_double_cacheline kF::Core::SPMCQueue
 {
 public:
@@ -107,12 +109,20 @@ public:
     [[nodiscard]] std::size_t size(void) const noexcept;
 
 
+    /** @brief Get a snapshot of the queue statistics, empty unless 'Instrumented' is true */
+    [[nodiscard]] inline QueueStatistics statistics(void) const noexcept { return _instrumentation.snapshot(); }
+
+    /** @brief Reset the queue statistics */
+    inline void resetStatistics(void) noexcept { _instrumentation.reset(); }
+
+
 private:
     alignas_cacheline std::atomic<size_t> _tail { 0 }; // Tail accessed by both producer and consumer threads
     alignas_cacheline ProducerCache _tailCache {}; // Cache accessed by producer thread
 
     alignas_cacheline std::atomic<size_t> _head { 0 }; // Head accessed by both producer and consumers threads
     alignas_cacheline ConsumerCache _headCache {}; // Cache accessed by consumer threads
+    [[no_unique_address]] QueueInstrumentation<Allocator, Instrumented> _instrumentation; // Statistics of the queue (empty when disabled)
 
 
     /** @brief Copy and move constructors disabled */
@@ -120,6 +130,14 @@ private:
     SPMCQueue(SPMCQueue &&other) = delete;
 
 
+    /** @brief Get the number of elements between the current head and 'tail' */
+    [[nodiscard]] inline std::size_t sizeUntil(const std::size_t tail) const noexcept
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : _tailCache.buffer.capacity - head + tail;
+    }
+
+
     /** @brief Implementation of push range */
     template<bool AllowLess, std::input_iterator InputIterator>
     [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to) noexcept;
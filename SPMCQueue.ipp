@@ -3,24 +3,25 @@
  * @ Description: SPMC Queue
  */
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::SPMCQueue<Type, Allocator>::~SPMCQueue(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::SPMCQueue<Type, Allocator, Instrumented>::~SPMCQueue(void) noexcept
 {
     clear();
     Allocator::Deallocate(_headCache.buffer.data, sizeof(Type) * _headCache.buffer.capacity, alignof(Type));
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::SPMCQueue<Type, Allocator>::SPMCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::SPMCQueue<Type, Allocator, Instrumented>::SPMCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+    : _instrumentation(capacity + usedAsBuffer)
 {
     _tailCache.buffer.capacity = capacity + usedAsBuffer;
     _tailCache.buffer.data = reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * _tailCache.buffer.capacity, alignof(Type)));
     _headCache.buffer = _tailCache.buffer;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool MoveOnSuccess, typename ...Args>
-inline bool kF::Core::SPMCQueue<Type, Allocator>::push(Args &&...args) noexcept
+inline bool kF::Core::SPMCQueue<Type, Allocator, Instrumented>::push(Args &&...args) noexcept
 {
     const auto tail = _tail.load(std::memory_order_acquire);
     auto next = tail + 1;
@@ -29,19 +30,22 @@ inline bool kF::Core::SPMCQueue<Type, Allocator>::push(Args &&...args) noexcept
         next = 0;
     if (auto head = _tailCache.value; next == head) [[unlikely]] {
         head = _tailCache.value = _head.load(std::memory_order_acquire);
-        if (next == head) [[unlikely]]
+        if (next == head) [[unlikely]] {
+            _instrumentation.onPushFailure();
             return false;
+        }
     }
     if constexpr (MoveOnSuccess)
         new (_tailCache.buffer.data + tail) Type(std::move(args)...);
     else
         new (_tailCache.buffer.data + tail) Type(std::forward<Args>(args)...);
+    _instrumentation.onPush(tail, 1, [this, next] { return sizeUntil(next); });
     _tail.store(next, std::memory_order_release);
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline bool kF::Core::SPMCQueue<Type, Allocator>::pop(Type &value) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline bool kF::Core::SPMCQueue<Type, Allocator, Instrumented>::pop(Type &value) noexcept
 {
     auto head = _headCache.value.load(std::memory_order_acquire);
     auto tail = _tail.load(std::memory_order_acquire);
@@ -74,6 +78,7 @@ inline bool kF::Core::SPMCQueue<Type, Allocator>::pop(Type &value) noexcept
     else
         value = *elem;
     elem->~Type();
+    _instrumentation.onPop(head, 1);
     // Loop while the transaction is not done (may wait prior thread with longer extraction)
     auto expected = head;
     while (!_head.compare_exchange_weak(expected, next, std::memory_order_acq_rel)) [[unlikely]]
@@ -81,9 +86,9 @@ inline bool kF::Core::SPMCQueue<Type, Allocator>::pop(Type &value) noexcept
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, std::input_iterator InputIterator>
-inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
+inline std::size_t kF::Core::SPMCQueue<Type, Allocator, Instrumented>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
 {
     auto toPush = static_cast<std::size_t>(to - from);
     const auto tail = _tail.load(std::memory_order_relaxed);
@@ -99,6 +104,7 @@ inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::pushRangeImpl(const Inp
         if (available > capacity) [[unlikely]]
             available -= capacity;
         if (toPush >= available) [[unlikely]] {
+            _instrumentation.onPushFailure();
             if constexpr (AllowLess)
                 toPush = available - 1;
             else
@@ -117,13 +123,14 @@ inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::pushRangeImpl(const Inp
         std::uninitialized_move_n(from, toPush, _tailCache.buffer.data + tail);
         std::destroy_n(from, toPush);
     }
+    _instrumentation.onPush(tail, toPush, [this, next] { return sizeUntil(next); });
     _tail.store(next, std::memory_order_release);
     return toPush;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
-inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
+inline std::size_t kF::Core::SPMCQueue<Type, Allocator, Instrumented>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
 {
     const auto capacity = _headCache.buffer.capacity;
     auto head = _headCache.value.load(std::memory_order_acquire);
@@ -174,6 +181,7 @@ inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::popRangeImpl(const Outp
         std::copy_n(std::make_move_iterator(_headCache.buffer.data + head), toPop, from);
         std::destroy_n(_headCache.buffer.data + head, toPop);
     }
+    _instrumentation.onPop(head, toPop);
     // Loop while the transaction is not done (may wait prior thread with longer extraction)
     auto expected = head;
     while (!_head.compare_exchange_weak(expected, next, std::memory_order_acq_rel)) [[unlikely]]
@@ -181,14 +189,14 @@ inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::popRangeImpl(const Outp
     return toPop;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::Core::SPMCQueue<Type, Allocator>::clear(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::SPMCQueue<Type, Allocator, Instrumented>::clear(void) noexcept
 {
     for (Type type; pop(type););
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline std::size_t kF::Core::SPMCQueue<Type, Allocator>::size(void) const noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline std::size_t kF::Core::SPMCQueue<Type, Allocator, Instrumented>::size(void) const noexcept
 {
     const auto tail = _tail.load(std::memory_order_seq_cst);
     const auto capacity = _tailCache.buffer.capacity;
@@ -10,11 +10,12 @@
 #include <memory>
 #include <algorithm>
 
+#include "QueueInstrumentation.hpp"
 #include "Utils.hpp"
 
 namespace kF::Core
 {
-    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
     class SPSCQueue;
 }
 
@@ -23,10 +24,12 @@ namespace kF::Core
  * The queue is really fast compared to other more flexible implementations because the fact that only two thread can simultaneously read / write
  * means that less synchronization is needed for each operation.
  * The queue supports ranged push / pop to insert multiple elements without performance impact
+ * Elements can also be constructed and read in place using reserve / commit and peek / release
  *
  * @tparam Type to be inserted
+ * @tparam Instrumented If true, the queue records statistics (defaults to 'KUBE_QUEUE_INSTRUMENTATION')
  */
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, bool Instrumented = KUBE_QUEUE_INSTRUMENTATION>
 class alignas_double_cacheline kF::Core::SPSCQueue
 {
 public:
@@ -91,6 +94,35 @@ public:
         { return popRangeImpl<true>(from, to); }
 
 
+    /** @brief Reserve up to 'maxCount' contiguous cells to construct elements in place
+     *  Cells are uninitialized, elements must be constructed before being committed
+     *  @return Reserved cells, empty if the queue is full */
+    [[nodiscard]] inline IteratorRange<Type *> reserve(const std::size_t maxCount) noexcept
+        { return reserveImpl<true>(maxCount); }
+
+    /** @brief Reserve exactly 'count' contiguous cells to construct elements in place
+     *  Reservations never wrap around the end of the ring, when too few cells remain before its end they are filled with
+     *  copies of 'padding' and committed so that the tail wraps. Consumers must discard padding elements
+     *  Retrying always succeeds once the consumer frees enough cells, even if the queue was empty near the end of the ring
+     *  @return Reserved cells, empty if 'count' contiguous cells are not available */
+    [[nodiscard]] inline IteratorRange<Type *> tryReserve(const std::size_t count, const Type &padding) noexcept
+        requires std::copy_constructible<Type>
+        { return reserveImpl<false, true>(count, &padding); }
+
+    /** @brief Publish the first 'count' constructed cells of the last reservation */
+    void commit(const std::size_t count) noexcept;
+
+    /** @brief Get the first element of the queue without extracting it
+     *  @return Pointer to the element or nullptr if the queue is empty */
+    [[nodiscard]] Type *peek(void) noexcept;
+
+    /** @brief Get up to 'maxCount' contiguous elements of the queue without extracting them */
+    [[nodiscard]] IteratorRange<Type *> peekRange(const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept;
+
+    /** @brief Destroy and release the first 'count' peeked elements */
+    void release(const std::size_t count) noexcept;
+
+
     /** @brief Clear all elements of the queue (unsafe) */
     void clear(void) noexcept;
 
@@ -99,12 +131,20 @@ public:
     [[nodiscard]] std::size_t size(void) const noexcept;
 
 
+    /** @brief Get a snapshot of the queue statistics, empty unless 'Instrumented' is true */
+    [[nodiscard]] inline QueueStatistics statistics(void) const noexcept { return _instrumentation.snapshot(); }
+
+    /** @brief Reset the queue statistics */
+    inline void resetStatistics(void) noexcept { _instrumentation.reset(); }
+
+
 private:
     alignas_cacheline std::atomic<size_t> _tail { 0 }; // Tail accessed by both producer and consumer
     alignas_cacheline Cache _tailCache {}; // Cache accessed by consumer thread
 
     alignas_cacheline std::atomic<size_t> _head { 0 }; // Head accessed by both producer and consumer
     alignas_cacheline Cache _headCache {}; // Cache accessed by producer thread
+    [[no_unique_address]] QueueInstrumentation<Allocator, Instrumented> _instrumentation; // Statistics of the queue (empty when disabled)
 
 
     /** @brief Copy and move constructors disabled */
@@ -112,6 +152,18 @@ private:
     SPSCQueue(SPSCQueue &&other) = delete;
 
 
+    /** @brief Get the number of elements between the current head and 'tail' */
+    [[nodiscard]] inline std::size_t sizeUntil(const std::size_t tail) const noexcept
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : _tailCache.buffer.capacity - head + tail;
+    }
+
+
+    /** @brief Implementation of reserve, if 'Pad' is true the end of the ring is padded when it is too small */
+    template<bool AllowLess, bool Pad = false>
+    [[nodiscard]] IteratorRange<Type *> reserveImpl(const std::size_t count, const Type * const padding = nullptr) noexcept;
+
     /** @brief Implementation of push range */
     template<bool AllowLess, std::input_iterator InputIterator>
     [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to) noexcept;
@@ -3,15 +3,16 @@
  * @ Description: SPSC Queue
  */
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::SPSCQueue<Type, Allocator>::~SPSCQueue(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::SPSCQueue<Type, Allocator, Instrumented>::~SPSCQueue(void) noexcept
 {
     clear();
     Allocator::Deallocate(_headCache.buffer.data, sizeof(Type) * _headCache.buffer.capacity, alignof(Type));
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::Core::SPSCQueue<Type, Allocator>::SPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::SPSCQueue<Type, Allocator, Instrumented>::SPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+    : _instrumentation(capacity + usedAsBuffer)
 {
     _tailCache.buffer.capacity = capacity + usedAsBuffer;
     _tailCache.buffer.data = reinterpret_cast<Type *>(
@@ -20,9 +21,9 @@ inline kF::Core::SPSCQueue<Type, Allocator>::SPSCQueue(const std::size_t capacit
     _headCache.buffer = _tailCache.buffer;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool MoveOnSuccess, typename ...Args>
-inline bool kF::Core::SPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
+inline bool kF::Core::SPSCQueue<Type, Allocator, Instrumented>::push(Args &&...args) noexcept
 {
     const auto tail = _tail.load(std::memory_order_relaxed);
     auto next = tail + 1;
@@ -31,19 +32,22 @@ inline bool kF::Core::SPSCQueue<Type, Allocator>::push(Args &&...args) noexcept
         next = 0;
     if (auto head = _tailCache.value; next == head) [[unlikely]] {
         head = _tailCache.value = _head.load(std::memory_order_acquire);
-        if (next == head) [[unlikely]]
+        if (next == head) [[unlikely]] {
+            _instrumentation.onPushFailure();
             return false;
+        }
     }
     if constexpr (MoveOnSuccess)
         new (_tailCache.buffer.data + tail) Type(std::move(args)...);
     else
         new (_tailCache.buffer.data + tail) Type(std::forward<Args>(args)...);
+    _instrumentation.onPush(tail, 1, [this, next] { return sizeUntil(next); });
     _tail.store(next, std::memory_order_release);
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline bool kF::Core::SPSCQueue<Type, Allocator>::pop(Type &value) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline bool kF::Core::SPSCQueue<Type, Allocator, Instrumented>::pop(Type &value) noexcept
 {
     const auto head = _head.load(std::memory_order_relaxed);
 
@@ -61,13 +65,14 @@ inline bool kF::Core::SPSCQueue<Type, Allocator>::pop(Type &value) noexcept
     else
         value = *elem;
     elem->~Type();
+    _instrumentation.onPop(head, 1);
     _head.store(next, std::memory_order_release);
     return true;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, std::input_iterator InputIterator>
-inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
+inline std::size_t kF::Core::SPSCQueue<Type, Allocator, Instrumented>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
 {
     std::size_t toPush = to - from;
     const auto tail = _tail.load(std::memory_order_relaxed);
@@ -83,6 +88,7 @@ inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
         if (available > capacity) [[unlikely]]
             available -= capacity;
         if (toPush >= available) [[unlikely]] {
+            _instrumentation.onPushFailure();
             if constexpr (AllowLess)
                 toPush = available - 1;
             else
@@ -101,13 +107,14 @@ inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::pushRangeImpl(const Inp
         std::uninitialized_move_n(from, toPush, _tailCache.buffer.data + tail);
         std::destroy_n(from, toPush);
     }
+    _instrumentation.onPush(tail, toPush, [this, next] { return sizeUntil(next); });
     _tail.store(next, std::memory_order_release);
     return toPush;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
 template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
-inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
+inline std::size_t kF::Core::SPSCQueue<Type, Allocator, Instrumented>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
 {
     std::size_t toPop = to - from;
     const auto head = _head.load(std::memory_order_relaxed);
@@ -141,18 +148,105 @@ inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::popRangeImpl(const Outp
         std::copy_n(std::make_move_iterator(_headCache.buffer.data + head), toPop, from);
         std::destroy_n(_headCache.buffer.data + head, toPop);
     }
+    _instrumentation.onPop(head, toPop);
     _head.store(next, std::memory_order_release);
     return toPop;
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::Core::SPSCQueue<Type, Allocator>::clear(void) noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+template<bool AllowLess, bool Pad>
+inline kF::Core::IteratorRange<Type *> kF::Core::SPSCQueue<Type, Allocator, Instrumented>::reserveImpl(const std::size_t count, const Type * const padding) noexcept
+{
+    auto tail = _tail.load(std::memory_order_relaxed);
+    const auto capacity = _tailCache.buffer.capacity;
+    // Writable cells are contiguous up to the cell preceding head or the end of the buffer
+    const auto contiguousCount = [&tail, capacity](const std::size_t head) { return head > tail ? head - tail - 1 : capacity - tail - !head; };
+    auto available = contiguousCount(_tailCache.value);
+
+    if (available < count) [[unlikely]] {
+        _tailCache.value = _head.load(std::memory_order_acquire);
+        available = contiguousCount(_tailCache.value);
+        // Pad the end of the ring so that the tail wraps, unless head is at the beginning or count can't ever fit
+        if constexpr (Pad) {
+            const auto head = _tailCache.value;
+            if (available < count && head && head <= tail && count < capacity) {
+                for (auto cell = _tailCache.buffer.data + tail, end = _tailCache.buffer.data + capacity; cell != end; ++cell)
+                    new (cell) Type(*padding);
+                commit(available);
+                tail = 0;
+                available = contiguousCount(head);
+            }
+        }
+        if (available < count) [[unlikely]] {
+            _instrumentation.onPushFailure();
+            if constexpr (!AllowLess)
+                return IteratorRange<Type *> {};
+        }
+    }
+    available = std::min(available, count);
+    return IteratorRange<Type *> { _tailCache.buffer.data + tail, _tailCache.buffer.data + tail + available };
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::SPSCQueue<Type, Allocator, Instrumented>::commit(const std::size_t count) noexcept
+{
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    auto next = tail + count;
+
+    if (next == _tailCache.buffer.capacity) [[unlikely]]
+        next = 0;
+    _instrumentation.onPush(tail, count, [this, next] { return sizeUntil(next); });
+    _tail.store(next, std::memory_order_release);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline Type *kF::Core::SPSCQueue<Type, Allocator, Instrumented>::peek(void) noexcept
+{
+    const auto range = peekRange(1);
+
+    return range.empty() ? nullptr : range.begin();
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline kF::Core::IteratorRange<Type *> kF::Core::SPSCQueue<Type, Allocator, Instrumented>::peekRange(const std::size_t maxCount) noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.buffer.capacity;
+    // Readable cells are contiguous up to the tail or the end of the buffer
+    const auto contiguousCount = [head, capacity](const std::size_t tail) { return tail >= head ? tail - head : capacity - head; };
+    auto count = contiguousCount(_headCache.value);
+
+    if (count < maxCount) [[unlikely]] {
+        _headCache.value = _tail.load(std::memory_order_acquire);
+        count = contiguousCount(_headCache.value);
+    }
+    count = std::min(count, maxCount);
+    return IteratorRange<Type *> { _headCache.buffer.data + head, _headCache.buffer.data + head + count };
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::SPSCQueue<Type, Allocator, Instrumented>::release(const std::size_t count) noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    auto next = head + count;
+
+    std::destroy_n(_headCache.buffer.data + head, count);
+    if (next == _headCache.buffer.capacity) [[unlikely]]
+        next = 0;
+    _instrumentation.onPop(head, count);
+    _head.store(next, std::memory_order_release);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline void kF::Core::SPSCQueue<Type, Allocator, Instrumented>::clear(void) noexcept
 {
-    for (Type type; pop(type););
+    // Elements are destroyed in place, 'Type' doesn't have to be default constructible
+    for (auto range = peekRange(); !range.empty(); range = peekRange())
+        release(range.size());
 }
 
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
-inline std::size_t kF::Core::SPSCQueue<Type, Allocator>::size(void) const noexcept
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool Instrumented>
+inline std::size_t kF::Core::SPSCQueue<Type, Allocator, Instrumented>::size(void) const noexcept
 {
     const auto tail = _tail.load(std::memory_order_seq_cst);
     const auto capacity = _tailCache.buffer.capacity;
@@ -0,0 +1,21 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SPSC Record Queue
+ */
+
+#pragma once
+
+#include "RecordQueueDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief The SPSC record queue is a lock-free queue of heterogeneous records that supports a Single Producer and a Single Consumer
+     * Records are constructed inline inside the ring with 'emplace<Type>(args...)' and visited by 'consume(visitor)'
+     *
+     * @tparam Types std::tuple of the record types that can be inserted
+     * @tparam Allocator Static allocator
+     */
+    template<typename Types, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+    using SPSCRecordQueue = Internal::RecordQueueDetails<Types, Allocator, false>;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Scheduler
+ */
+
+#pragma once
+
+#include <thread>
+
+#include "Functor.hpp"
+#include "HeapArray.hpp"
+#include "MPMCQueue.hpp"
+#include "UnboundedMPMCQueue.hpp"
+#include "WorkStealingDeque.hpp"
+
+namespace kF::Core
+{
+    template<kF::Core::StaticAllocatorRequirements Allocator>
+    class Scheduler;
+}
+
+/**
+ * @brief The scheduler is a work stealing thread pool
+ * Each worker owns a work stealing deque in which it pushes the tasks it schedules and from which it pops in LIFO order.
+ * Tasks scheduled from external threads go through a shared injection queue.
+ * Idle workers steal from the other workers before parking themselves, parked workers are woken up on new tasks.
+ * Task storage is recycled to prevent allocations on schedule.
+ *
+ * @tparam Allocator Static allocator
+ */
+template<kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class kF::Core::Scheduler
+{
+public:
+    /** @brief Task functor */
+    using Task = Functor<void(void), Allocator>;
+
+    /** @brief Default capacity of each worker queue */
+    static constexpr std::size_t DefaultQueueCapacity = 4096;
+
+    /** @brief Capacity of the recycled task cache */
+    static constexpr std::size_t TaskCacheCapacity = 4096;
+
+    /** @brief Number of unsuccessful task lookups before a worker parks itself */
+    static constexpr std::size_t IdleSpinCount = 64;
+
+    /** @brief Worker structure */
+    struct alignas_double_cacheline Worker
+    {
+        WorkStealingDeque<Task *, Allocator> deque;
+        Scheduler *parent {};
+        std::thread thread {};
+
+        /** @brief Construct a worker */
+        inline Worker(Scheduler * const parent_, const std::size_t queueCapacity) noexcept
+            : deque(queueCapacity), parent(parent_) {}
+    };
+
+
+    /** @brief Wait all scheduled tasks then join workers */
+    ~Scheduler(void) noexcept;
+
+    /** @brief Construct the scheduler and start its workers
+     *  @param workerCount Number of workers, if null the hardware concurrency is used
+     *  @param queueCapacity Capacity of each worker queue, must be a power of 2 */
+    Scheduler(const std::size_t workerCount = 0ul, const std::size_t queueCapacity = DefaultQueueCapacity) noexcept;
+
+
+    /** @brief Schedule a task */
+    template<typename Callable>
+    void schedule(Callable &&callable) noexcept;
+
+    /** @brief Execute a single pending task on the calling thread
+     *  @return true if a task has been executed */
+    bool executeOne(void) noexcept;
+
+    /** @brief Help executing tasks until every scheduled task is done
+     *  Must not be called from inside a task: the calling task is itself pending, thus waiting would deadlock
+     *  Tasks waiting for their children should track them (ex: TaskGraph or a counter) and help with 'executeOne' */
+    void waitIdle(void) noexcept;
+
+
+    /** @brief Get the number of workers */
+    [[nodiscard]] inline std::size_t workerCount(void) const noexcept { return _workers.size(); }
+
+    /** @brief Check if the calling thread is a worker of this scheduler */
+    [[nodiscard]] inline bool isWorkerThread(void) const noexcept { return localWorker() != nullptr; }
+
+
+private:
+    alignas_cacheline std::atomic<std::size_t> _pendingTasks { 0 }; // Number of tasks not done yet
+    alignas_cacheline std::atomic<std::size_t> _queuedTasks { 0 }; // Number of tasks not taken yet
+    alignas_cacheline std::atomic<std::uint32_t> _wakeEpoch { 0 }; // Epoch used to park / wake workers
+    std::atomic<std::uint32_t> _sleepingWorkers { 0 }; // Number of parking workers
+    std::atomic<bool> _running { true };
+    alignas_cacheline UnboundedMPMCQueue<Task *, Allocator> _injection {};
+    MPMCQueue<Task *, Allocator> _taskCache;
+    HeapArray<Worker, Allocator, std::size_t> _workers {};
+
+    /** @brief Worker of the calling thread, if any */
+    static inline thread_local Worker *CurrentWorker {};
+
+
+    /** @brief Copy and move constructors disabled */
+    Scheduler(const Scheduler &other) = delete;
+    Scheduler(Scheduler &&other) = delete;
+
+
+    /** @brief Worker thread entry point */
+    void workerMain(Worker &worker) noexcept;
+
+    /** @brief Get the worker of the calling thread if it belongs to this scheduler */
+    [[nodiscard]] Worker *localWorker(void) const noexcept;
+
+    /** @brief Try to steal a task from any other worker */
+    [[nodiscard]] bool stealTask(Task *&task, const Worker * const thief) noexcept;
+
+    /** @brief Wake a single parked worker if any */
+    void notifyWorker(void) noexcept;
+
+
+    /** @brief Get a task storage from the cache or allocate it */
+    template<typename Callable>
+    [[nodiscard]] Task *makeTask(Callable &&callable) noexcept;
+
+    /** @brief Destroy a task and store it into the cache or deallocate it */
+    void releaseTask(Task * const task) noexcept;
+};
+
+#include "Scheduler.ipp"
\ No newline at end of file
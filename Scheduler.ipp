@@ -0,0 +1,153 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Scheduler
+ */
+
+#include "Abort.hpp"
+#include "Assert.hpp"
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::Scheduler<Allocator>::~Scheduler(void) noexcept
+{
+    waitIdle();
+    _running.store(false, std::memory_order_seq_cst);
+    _wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    _wakeEpoch.notify_all();
+    for (auto &worker : _workers) {
+        if (worker.thread.joinable())
+            worker.thread.join();
+    }
+    // Execute tasks scheduled by other tasks during shutdown
+    while (executeOne());
+    for (Task *task; _taskCache.pop(task);)
+        Allocator::Deallocate(task, sizeof(Task), alignof(Task));
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::Scheduler<Allocator>::Scheduler(const std::size_t workerCount, const std::size_t queueCapacity) noexcept
+    : _taskCache(TaskCacheCapacity)
+{
+    const auto count = workerCount ? workerCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1ul);
+
+    _workers.allocate(count, this, queueCapacity);
+    for (auto &worker : _workers)
+        worker.thread = std::thread([this, &worker] { workerMain(worker); });
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callable>
+inline void kF::Core::Scheduler<Allocator>::schedule(Callable &&callable) noexcept
+{
+    auto * const task = makeTask(std::forward<Callable>(callable));
+    auto * const worker = localWorker();
+
+    _pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    // Counted before insertion so that a parking worker never misses the task
+    _queuedTasks.fetch_add(1, std::memory_order_seq_cst);
+    if (!worker || !worker->deque.push(task)) [[unlikely]]
+        _injection.push(task);
+    notifyWorker();
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::Scheduler<Allocator>::executeOne(void) noexcept
+{
+    auto * const worker = localWorker();
+    Task *task;
+
+    if (!(worker && worker->deque.pop(task)) && !_injection.pop(task) && !stealTask(task, worker))
+        return false;
+    _queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    (*task)();
+    releaseTask(task);
+    _pendingTasks.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::Scheduler<Allocator>::waitIdle(void) noexcept
+{
+    kFAssert(!isWorkerThread(), "Scheduler::waitIdle: Can't wait for idle from a worker thread, the calling task would wait for itself");
+    while (_pendingTasks.load(std::memory_order_acquire)) {
+        if (!executeOne())
+            std::this_thread::yield();
+    }
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::Scheduler<Allocator>::workerMain(Worker &worker) noexcept
+{
+    CurrentWorker = &worker;
+    auto idleCount = 0ul;
+
+    while (true) {
+        if (executeOne()) {
+            idleCount = 0ul;
+            continue;
+        } else if (!_running.load(std::memory_order_acquire)) [[unlikely]]
+            break;
+        else if (++idleCount < IdleSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        // Park the worker, the epoch is read before checking tasks so that no notification can be missed
+        idleCount = 0ul;
+        const auto epoch = _wakeEpoch.load(std::memory_order_seq_cst);
+        _sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        if (!_queuedTasks.load(std::memory_order_seq_cst) && _running.load(std::memory_order_seq_cst))
+            _wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+        _sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    CurrentWorker = nullptr;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline typename kF::Core::Scheduler<Allocator>::Worker *kF::Core::Scheduler<Allocator>::localWorker(void) const noexcept
+{
+    auto * const worker = CurrentWorker;
+    return worker && worker->parent == this ? worker : nullptr;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::Scheduler<Allocator>::stealTask(Task *&task, const Worker * const thief) noexcept
+{
+    const auto count = _workers.size();
+    const auto offset = thief ? static_cast<std::size_t>(thief - _workers.begin()) + 1ul : 0ul;
+
+    for (auto i = 0ul; i != count; ++i) {
+        auto &victim = _workers[(offset + i) % count];
+        if (&victim != thief && victim.deque.steal(task))
+            return true;
+    }
+    return false;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::Scheduler<Allocator>::notifyWorker(void) noexcept
+{
+    if (_sleepingWorkers.load(std::memory_order_seq_cst)) {
+        _wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+        _wakeEpoch.notify_one();
+    }
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callable>
+inline typename kF::Core::Scheduler<Allocator>::Task *kF::Core::Scheduler<Allocator>::makeTask(Callable &&callable) noexcept
+{
+    Task *task;
+
+    if (!_taskCache.pop(task)) {
+        task = reinterpret_cast<Task *>(Allocator::Allocate(sizeof(Task), alignof(Task)));
+        kFEnsure(task, "Core::Scheduler: Allocation of task failed");
+    }
+    return new (task) Task(std::forward<Callable>(callable));
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::Scheduler<Allocator>::releaseTask(Task * const task) noexcept
+{
+    task->~Task();
+    if (!_taskCache.push(task)) [[unlikely]]
+        Allocator::Deallocate(task, sizeof(Task), alignof(Task));
+}
\ No newline at end of file
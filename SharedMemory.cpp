@@ -0,0 +1,120 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared Memory
+ */
+
+#include <cstring>
+
+#include "Platform.hpp"
+#include "SharedMemory.hpp"
+
+#if KUBE_PLATFORM_WINDOWS
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace kF;
+
+Core::SharedMemory::~SharedMemory(void) noexcept
+{
+    if (!_data)
+        return;
+#if KUBE_PLATFORM_WINDOWS
+    UnmapViewOfFile(_data);
+    CloseHandle(_handle);
+#else
+    munmap(_data, _size);
+    if (isOwner())
+        shm_unlink(_ownedName.data());
+#endif
+}
+
+void Core::SharedMemory::swap(SharedMemory &other) noexcept
+{
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    std::swap(_handle, other._handle);
+    _ownedName.swap(other._ownedName);
+}
+
+Core::SharedMemory Core::SharedMemory::Create(const char * const name, const std::size_t size) noexcept
+{
+    SharedMemory memory;
+
+#if KUBE_PLATFORM_WINDOWS
+    const auto handle = CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(static_cast<std::uint64_t>(size) >> 32), static_cast<DWORD>(size), name
+    );
+    if (!handle)
+        return memory;
+    else if (GetLastError() == ERROR_ALREADY_EXISTS) {
+        CloseHandle(handle);
+        return memory;
+    }
+    const auto data = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!data) {
+        CloseHandle(handle);
+        return memory;
+    }
+    memory._handle = handle;
+#else
+    const auto fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd == -1)
+        return memory;
+    void *data = MAP_FAILED;
+    // A fresh shared memory object is zero-filled by 'ftruncate'
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0)
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        shm_unlink(name);
+        return memory;
+    }
+#endif
+    const auto nameLength = std::strlen(name) + 1;
+    memory._data = data;
+    memory._size = size;
+    memory._ownedName.allocate(static_cast<std::uint32_t>(nameLength));
+    std::memcpy(memory._ownedName.data(), name, nameLength);
+    return memory;
+}
+
+Core::SharedMemory Core::SharedMemory::Open(const char * const name) noexcept
+{
+    SharedMemory memory;
+
+#if KUBE_PLATFORM_WINDOWS
+    const auto handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, false, name);
+    if (!handle)
+        return memory;
+    const auto data = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION info;
+    if (!data || !VirtualQuery(data, &info, sizeof(info))) {
+        if (data)
+            UnmapViewOfFile(data);
+        CloseHandle(handle);
+        return memory;
+    }
+    memory._handle = handle;
+    memory._size = info.RegionSize;
+#else
+    const auto fd = shm_open(name, O_RDWR, 0600);
+    if (fd == -1)
+        return memory;
+    struct stat info;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+        data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return memory;
+    memory._size = static_cast<std::size_t>(info.st_size);
+#endif
+    memory._data = data;
+    return memory;
+}
\ No newline at end of file
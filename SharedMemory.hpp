@@ -0,0 +1,70 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared Memory
+ */
+
+#pragma once
+
+#include "HeapArray.hpp"
+
+namespace kF::Core
+{
+    class SharedMemory;
+}
+
+/**
+ * @brief Named memory region mapped by multiple processes
+ * On POSIX systems the region is created with 'shm_open' and mapped with 'mmap'.
+ * The process that created the region unlinks its name on destruction, processes that already opened it keep their mapping.
+ * @note The base address of the mapping differs from one process to another, only store offsets inside the region
+ */
+class kF::Core::SharedMemory
+{
+public:
+    /** @brief Unmap the region and unlink its name if it has been created by this instance */
+    ~SharedMemory(void) noexcept;
+
+    /** @brief Construct an invalid region */
+    inline SharedMemory(void) noexcept = default;
+
+    /** @brief Move constructor */
+    inline SharedMemory(SharedMemory &&other) noexcept { swap(other); }
+
+    /** @brief Move assignment */
+    inline SharedMemory &operator=(SharedMemory &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(SharedMemory &other) noexcept;
+
+
+    /** @brief Create a zero-initialized named region of 'size' bytes, fails if the name already exists
+     *  @return An invalid region on failure */
+    [[nodiscard]] static SharedMemory Create(const char * const name, const std::size_t size) noexcept;
+
+    /** @brief Open an existing named region
+     *  @return An invalid region on failure */
+    [[nodiscard]] static SharedMemory Open(const char * const name) noexcept;
+
+
+    /** @brief Valid check */
+    [[nodiscard]] inline explicit operator bool(void) const noexcept { return _data; }
+
+    /** @brief Get the base address of the mapping */
+    [[nodiscard]] inline void *data(void) const noexcept { return _data; }
+
+    /** @brief Get the size in bytes of the mapping */
+    [[nodiscard]] inline std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Check if the region has been created by this instance */
+    [[nodiscard]] inline bool isOwner(void) const noexcept { return !_ownedName.empty(); }
+
+
+private:
+    void *_data {};
+    std::size_t _size { 0 };
+    void *_handle {};
+    HeapArray<char> _ownedName {};
+
+    /** @brief Copy constructor disabled */
+    SharedMemory(const SharedMemory &other) = delete;
+};
\ No newline at end of file
@@ -11,20 +11,27 @@
 
 namespace kF::Core
 {
-    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, bool IsAtomic>
     class SharedPtr;
+
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    class AtomicSharedPtr;
 }
 
-/** @brief Shared pointer class */
-template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+/** @brief Shared pointer class
+ *  If 'IsAtomic' is false, the reference count is a plain integer and the pointer must be confined to a single thread */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, bool IsAtomic = true>
 class kF::Core::SharedPtr
 {
 public:
+    /** @brief Reference count type */
+    using Count = std::conditional_t<IsAtomic, std::atomic<std::uint32_t>, std::uint32_t>;
+
     /** @brief Allocated data of the shared pointer */
     struct Data
     {
         Type value {};
-        std::atomic<std::uint32_t> count { 1u };
+        Count count { 1u };
 
 
         /** @brief Destructor */
@@ -76,8 +83,8 @@ public:
     [[nodiscard]] explicit inline operator const Type *(void) const noexcept { return get(); }
 
 
-    /** @brief Load atomic reference count */
-    [[nodiscard]] inline std::uint32_t referenceCount(void) const noexcept { return _ptr ? _ptr->count.load() : 0u; }
+    /** @brief Load reference count */
+    [[nodiscard]] inline std::uint32_t referenceCount(void) const noexcept { return _ptr ? static_cast<std::uint32_t>(_ptr->count) : 0u; }
 
 
     /** @brief Mutable managed object getter */
@@ -117,6 +124,9 @@ public:
     [[nodiscard]] inline bool operator!=(Type * const other) const noexcept { return get() != other; }
 
 private:
+    /** @brief Atomic shared pointer transfers references without touching the count */
+    friend class AtomicSharedPtr<Type, Allocator>;
+
     /** @brief Instance constructor */
     inline SharedPtr(Data * const ptr) : _ptr(ptr) {}
 
@@ -134,4 +144,11 @@ private:
     }
 
     Data *_ptr {};
-};
\ No newline at end of file
+};
+
+namespace kF::Core
+{
+    /** @brief Shared pointer with a non-atomic reference count, restricted to a single thread */
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+    using LocalSharedPtr = SharedPtr<Type, Allocator, false>;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared Record Queue
+ */
+
+#pragma once
+
+#include "SharedSPSCQueue.hpp"
+
+namespace kF::Core
+{
+    class SharedRecordQueue;
+}
+
+/**
+ * @brief The shared record queue transfers variable-length byte records through a shared SPSC queue of 8 bytes blocks
+ * Each record is stored contiguously as a header block holding its size followed by its payload.
+ * When a record does not fit before the end of the ring, a padding record fills the remaining blocks and the record is
+ * written at the beginning of the ring.
+ */
+class kF::Core::SharedRecordQueue
+{
+public:
+    /** @brief Storage unit of the ring */
+    struct alignas(8) Block
+    {
+        std::byte data[8];
+    };
+
+    /** @brief Size stored in the header of a padding record */
+    static constexpr std::uint32_t PaddingRecord = ~static_cast<std::uint32_t>(0);
+
+
+    /** @brief Get the required region size to store 'byteCapacity' bytes of records (headers included) */
+    [[nodiscard]] static constexpr std::size_t RequiredSize(const std::size_t byteCapacity) noexcept
+        { return SharedSPSCQueue<Block>::RequiredSize((byteCapacity + sizeof(Block) - 1) / sizeof(Block)); }
+
+    /** @brief Get the number of blocks used by a record of 'size' bytes */
+    [[nodiscard]] static constexpr std::size_t BlockCount(const std::uint32_t size) noexcept
+        { return 1 + (static_cast<std::size_t>(size) + sizeof(Block) - 1) / sizeof(Block); }
+
+
+    /** @brief Construct the queue over 'region' of 'regionSize' bytes (see SharedSPSCQueue) */
+    inline SharedRecordQueue(void * const region, const std::size_t regionSize, const bool initialize) noexcept
+        : _queue(region, regionSize, initialize) {}
+
+
+    /** @brief Push a record of 'size' bytes into the queue
+     *  @return true if the record has been inserted */
+    [[nodiscard]] bool push(const void * const data, const std::uint32_t size) noexcept;
+
+    /** @brief Pop a single record and pass it to 'callback' as (const std::byte *data, std::uint32_t size)
+     *  The record data is only valid during the callback
+     *  @return true if a record has been extracted */
+    template<typename Callback>
+    [[nodiscard]] bool pop(Callback &&callback) noexcept;
+
+
+    /** @brief Check if the queue is empty */
+    [[nodiscard]] inline bool empty(void) const noexcept { return !_queue.size(); }
+
+
+private:
+    SharedSPSCQueue<Block> _queue;
+
+
+    /** @brief Read the size stored in a header block */
+    [[nodiscard]] static inline std::uint32_t ReadSize(const Block * const block) noexcept
+        { std::uint32_t size; std::memcpy(&size, block->data, sizeof(size)); return size; }
+
+    /** @brief Write a size into a header block */
+    static inline void WriteSize(Block * const block, const std::uint32_t size) noexcept
+        { std::memcpy(block->data, &size, sizeof(size)); }
+};
+
+#include "SharedRecordQueue.ipp"
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared Record Queue
+ */
+
+#include "Assert.hpp"
+
+inline bool kF::Core::SharedRecordQueue::push(const void * const data, const std::uint32_t size) noexcept
+{
+    const auto blockCount = BlockCount(size);
+
+    kFAssert(size != PaddingRecord && blockCount < _queue.capacity(),
+        "Core::SharedRecordQueue::push: Record is too large");
+    auto reservation = _queue.reserve(blockCount);
+    if (reservation.size() < blockCount) [[unlikely]] {
+        // If the free blocks are not at the end of the ring, the queue is full
+        if (reservation.empty() || reservation.end() != _queue.data() + _queue.capacity())
+            return false;
+        // Skip the end of the ring with a padding record
+        WriteSize(reservation.begin(), PaddingRecord);
+        _queue.commit(reservation.size());
+        reservation = _queue.tryReserve(blockCount);
+        if (reservation.empty()) [[unlikely]]
+            return false;
+    }
+    WriteSize(reservation.begin(), size);
+    std::memcpy(reservation.begin() + 1, data, size);
+    _queue.commit(blockCount);
+    return true;
+}
+
+template<typename Callback>
+inline bool kF::Core::SharedRecordQueue::pop(Callback &&callback) noexcept
+{
+    auto range = _queue.peekRange(1);
+
+    if (range.empty()) [[unlikely]]
+        return false;
+    auto size = ReadSize(range.begin());
+    if (size == PaddingRecord) [[unlikely]] {
+        // Padding always extends to the end of the ring
+        _queue.release(static_cast<std::size_t>(_queue.data() + _queue.capacity() - range.begin()));
+        range = _queue.peekRange(1);
+        if (range.empty()) [[unlikely]]
+            return false;
+        size = ReadSize(range.begin());
+    }
+    const auto blockCount = BlockCount(size);
+    range = _queue.peekRange(blockCount);
+    kFAssert(range.size() == blockCount,
+        "Core::SharedRecordQueue::pop: Record is not contiguous");
+    callback(reinterpret_cast<const std::byte *>(range.begin() + 1), size);
+    _queue.release(blockCount);
+    return true;
+}
\ No newline at end of file
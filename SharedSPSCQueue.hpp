@@ -0,0 +1,161 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared SPSC Queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Type>
+    class SharedSPSCQueue;
+}
+
+/**
+ * @brief The shared SPSC queue is a variant of the SPSC queue living entirely inside a caller-provided memory region
+ * The region starts with a header containing the head / tail offsets and is followed by the cells, no pointer is stored inside it.
+ * This makes the queue usable across processes mapping the same region at different addresses (see SharedMemory).
+ * Each process constructs its own instance over the region, which keeps the local caches of the producer or the consumer.
+ * Only one instance may initialize the region, the other ones attach to it.
+ *
+ * @tparam Type to be inserted, must be trivially copyable
+ */
+template<typename Type>
+class alignas_double_cacheline kF::Core::SharedSPSCQueue
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type>, "SharedSPSCQueue: Type must be trivially copyable");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "SharedSPSCQueue: Atomic offsets must be lock-free to be shared across processes");
+
+    /** @brief Header stored at the beginning of the shared region */
+    struct alignas_double_cacheline Header
+    {
+        alignas_double_cacheline std::atomic<std::size_t> tail { 0 }; // Tail accessed by both producer and consumer
+        alignas_double_cacheline std::atomic<std::size_t> head { 0 }; // Head accessed by both producer and consumer
+        alignas_double_cacheline std::size_t capacity { 0 }; // Number of cells in the region
+        std::size_t cellSize { 0 }; // Size of a cell, used to detect mismatching attachments
+    };
+
+    /** @brief Offset of the first cell inside the region */
+    static constexpr std::size_t DataOffset = (sizeof(Header) + alignof(Type) - 1) & ~(alignof(Type) - 1);
+
+    /** @brief Local process cache */
+    struct Cache
+    {
+        Type *data {};
+        std::size_t capacity { 0 };
+        std::size_t value { 0 };
+    };
+
+
+    /** @brief Get the required region size to store 'capacity' elements */
+    [[nodiscard]] static constexpr std::size_t RequiredSize(const std::size_t capacity) noexcept
+        { return DataOffset + sizeof(Type) * (capacity + 1); }
+
+
+    /** @brief Construct the queue over 'region' of 'regionSize' bytes
+     *  If 'initialize' is true, the header is reset and the capacity is deduced from 'regionSize'
+     *  Else the queue attaches to an already initialized region */
+    SharedSPSCQueue(void * const region, const std::size_t regionSize, const bool initialize) noexcept;
+
+    /** @brief The region is left untouched */
+    inline ~SharedSPSCQueue(void) noexcept = default;
+
+
+    /** @brief Push a single element into the queue
+     *  @return true if the element has been inserted */
+    [[nodiscard]] bool push(const Type &value) noexcept;
+
+    /** @brief Pop a single element from the queue
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+
+    /** @brief Push exactly 'count' elements into the queue
+     *  @return Success on true */
+    [[nodiscard]] inline bool tryPushRange(const Type * const from, const Type * const to) noexcept
+        { return pushRangeImpl<false>(from, to); }
+
+    /** @brief Push up to 'count' elements into the queue
+     *  @return The number of inserted elements */
+    [[nodiscard]] inline std::size_t pushRange(const Type * const from, const Type * const to) noexcept
+        { return pushRangeImpl<true>(from, to); }
+
+
+    /** @brief Pop exactly 'count' elements from the queue
+     *  @return Success on true */
+    [[nodiscard]] inline bool tryPopRange(Type * const from, Type * const to) noexcept
+        { return popRangeImpl<false>(from, to); }
+
+    /** @brief Pop up to 'count' elements from the queue
+     *  @return The number of extracted elements */
+    [[nodiscard]] inline std::size_t popRange(Type * const from, Type * const to) noexcept
+        { return popRangeImpl<true>(from, to); }
+
+
+    /** @brief Reserve up to 'maxCount' contiguous cells to write elements in place
+     *  @return Reserved cells, empty if the queue is full */
+    [[nodiscard]] inline IteratorRange<Type *> reserve(const std::size_t maxCount) noexcept
+        { return reserveImpl<true>(maxCount); }
+
+    /** @brief Reserve exactly 'count' contiguous cells to write elements in place
+     *  @return Reserved cells, empty if 'count' contiguous cells are not available */
+    [[nodiscard]] inline IteratorRange<Type *> tryReserve(const std::size_t count) noexcept
+        { return reserveImpl<false>(count); }
+
+    /** @brief Publish the first 'count' written cells of the last reservation */
+    void commit(const std::size_t count) noexcept;
+
+    /** @brief Get the first element of the queue without extracting it
+     *  @return Pointer to the element or nullptr if the queue is empty */
+    [[nodiscard]] Type *peek(void) noexcept;
+
+    /** @brief Get up to 'maxCount' contiguous elements of the queue without extracting them */
+    [[nodiscard]] IteratorRange<Type *> peekRange(const std::size_t maxCount = ~static_cast<std::size_t>(0)) noexcept;
+
+    /** @brief Release the first 'count' peeked elements */
+    void release(const std::size_t count) noexcept;
+
+
+    /** @brief Get the size of the queue */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+    /** @brief Get the number of cells of the region (one cell is always kept unused) */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return _tailCache.capacity; }
+
+    /** @brief Get the first cell of the region in the current process */
+    [[nodiscard]] inline Type *data(void) const noexcept { return _tailCache.data; }
+
+
+private:
+    Header *_header {};
+    alignas_cacheline Cache _tailCache {}; // Cache accessed by producer
+    alignas_cacheline Cache _headCache {}; // Cache accessed by consumer
+
+
+    /** @brief Copy and move constructors disabled */
+    SharedSPSCQueue(const SharedSPSCQueue &other) = delete;
+    SharedSPSCQueue(SharedSPSCQueue &&other) = delete;
+
+
+    /** @brief Implementation of reserve */
+    template<bool AllowLess>
+    [[nodiscard]] IteratorRange<Type *> reserveImpl(const std::size_t count) noexcept;
+
+    /** @brief Implementation of push range */
+    template<bool AllowLess>
+    [[nodiscard]] std::size_t pushRangeImpl(const Type * const from, const Type * const to) noexcept;
+
+    /** @brief Implementation of pop range */
+    template<bool AllowLess>
+    [[nodiscard]] std::size_t popRangeImpl(Type * const from, Type * const to) noexcept;
+};
+
+#include "SharedSPSCQueue.ipp"
\ No newline at end of file
@@ -0,0 +1,214 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared SPSC Queue
+ */
+
+#include "Abort.hpp"
+
+template<typename Type>
+inline kF::Core::SharedSPSCQueue<Type>::SharedSPSCQueue(void * const region, const std::size_t regionSize, const bool initialize) noexcept
+    : _header(reinterpret_cast<Header *>(region))
+{
+    kFEnsure(!(reinterpret_cast<std::uintptr_t>(region) % alignof(Header)),
+        "Core::SharedSPSCQueue: Region is not aligned");
+    kFEnsure(regionSize >= RequiredSize(1),
+        "Core::SharedSPSCQueue: Region is too small");
+    if (initialize) {
+        new (_header) Header {};
+        _header->capacity = (regionSize - DataOffset) / sizeof(Type);
+        _header->cellSize = sizeof(Type);
+    } else {
+        kFEnsure(_header->cellSize == sizeof(Type) && DataOffset + _header->capacity * sizeof(Type) <= regionSize,
+            "Core::SharedSPSCQueue: Region layout mismatch");
+    }
+    _tailCache.data = reinterpret_cast<Type *>(reinterpret_cast<std::uint8_t *>(region) + DataOffset);
+    _tailCache.capacity = _header->capacity;
+    _tailCache.value = _header->head.load(std::memory_order_acquire);
+    _headCache.data = _tailCache.data;
+    _headCache.capacity = _tailCache.capacity;
+    _headCache.value = _header->tail.load(std::memory_order_acquire);
+}
+
+template<typename Type>
+inline bool kF::Core::SharedSPSCQueue<Type>::push(const Type &value) noexcept
+{
+    const auto tail = _header->tail.load(std::memory_order_relaxed);
+    auto next = tail + 1;
+
+    if (next == _tailCache.capacity) [[unlikely]]
+        next = 0;
+    if (auto head = _tailCache.value; next == head) [[unlikely]] {
+        head = _tailCache.value = _header->head.load(std::memory_order_acquire);
+        if (next == head) [[unlikely]]
+            return false;
+    }
+    std::memcpy(_tailCache.data + tail, &value, sizeof(Type));
+    _header->tail.store(next, std::memory_order_release);
+    return true;
+}
+
+template<typename Type>
+inline bool kF::Core::SharedSPSCQueue<Type>::pop(Type &value) noexcept
+{
+    const auto head = _header->head.load(std::memory_order_relaxed);
+
+    if (auto tail = _headCache.value; head == tail) [[unlikely]] {
+        tail = _headCache.value = _header->tail.load(std::memory_order_acquire);
+        if (head == tail) [[unlikely]]
+            return false;
+    }
+    auto next = head + 1;
+    if (next == _headCache.capacity) [[unlikely]]
+        next = 0;
+    std::memcpy(&value, _headCache.data + head, sizeof(Type));
+    _header->head.store(next, std::memory_order_release);
+    return true;
+}
+
+template<typename Type>
+template<bool AllowLess>
+inline std::size_t kF::Core::SharedSPSCQueue<Type>::pushRangeImpl(const Type * const from, const Type * const to) noexcept
+{
+    std::size_t toPush = to - from;
+    const auto tail = _header->tail.load(std::memory_order_relaxed);
+    const auto capacity = _tailCache.capacity;
+    auto head = _tailCache.value;
+    auto available = capacity - (tail - head);
+
+    if (available > capacity) [[unlikely]]
+        available -= capacity;
+    if (toPush >= available) [[unlikely]] {
+        head = _tailCache.value = _header->head.load(std::memory_order_acquire);
+        available = capacity - (tail - head);
+        if (available > capacity) [[unlikely]]
+            available -= capacity;
+        if (toPush >= available) [[unlikely]] {
+            if constexpr (AllowLess)
+                toPush = available - 1;
+            else
+                return 0;
+        }
+    }
+    auto next = tail + toPush;
+    if (next >= capacity) [[unlikely]] {
+        next -= capacity;
+        const auto split = toPush - next;
+        std::memcpy(_tailCache.data + tail, from, sizeof(Type) * split);
+        std::memcpy(_tailCache.data, from + split, sizeof(Type) * next);
+    } else
+        std::memcpy(_tailCache.data + tail, from, sizeof(Type) * toPush);
+    _header->tail.store(next, std::memory_order_release);
+    return toPush;
+}
+
+template<typename Type>
+template<bool AllowLess>
+inline std::size_t kF::Core::SharedSPSCQueue<Type>::popRangeImpl(Type * const from, Type * const to) noexcept
+{
+    std::size_t toPop = to - from;
+    const auto head = _header->head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.capacity;
+    auto tail = _headCache.value;
+    auto available = tail - head;
+
+    if (available > capacity) [[unlikely]]
+        available += capacity;
+    if (toPop > available) [[unlikely]] {
+        tail = _headCache.value = _header->tail.load(std::memory_order_acquire);
+        available = tail - head;
+        if (available > capacity) [[unlikely]]
+            available += capacity;
+        if (toPop > available) [[unlikely]] {
+            if constexpr (AllowLess)
+                toPop = available;
+            else
+                return 0;
+        }
+    }
+    auto next = head + toPop;
+    if (next >= capacity) [[unlikely]] {
+        next -= capacity;
+        const auto split = toPop - next;
+        std::memcpy(from, _headCache.data + head, sizeof(Type) * split);
+        std::memcpy(from + split, _headCache.data, sizeof(Type) * next);
+    } else
+        std::memcpy(from, _headCache.data + head, sizeof(Type) * toPop);
+    _header->head.store(next, std::memory_order_release);
+    return toPop;
+}
+
+template<typename Type>
+template<bool AllowLess>
+inline kF::Core::IteratorRange<Type *> kF::Core::SharedSPSCQueue<Type>::reserveImpl(const std::size_t count) noexcept
+{
+    const auto tail = _header->tail.load(std::memory_order_relaxed);
+    const auto capacity = _tailCache.capacity;
+    // Writable cells are contiguous up to the cell preceding head or the end of the buffer
+    const auto contiguousCount = [tail, capacity](const std::size_t head) { return head > tail ? head - tail - 1 : capacity - tail - !head; };
+    auto available = contiguousCount(_tailCache.value);
+
+    if (available < count) [[unlikely]] {
+        _tailCache.value = _header->head.load(std::memory_order_acquire);
+        available = contiguousCount(_tailCache.value);
+        if (available < count) [[unlikely]] {
+            if constexpr (!AllowLess)
+                return IteratorRange<Type *> {};
+        }
+    }
+    available = std::min(available, count);
+    return IteratorRange<Type *> { _tailCache.data + tail, _tailCache.data + tail + available };
+}
+
+template<typename Type>
+inline void kF::Core::SharedSPSCQueue<Type>::commit(const std::size_t count) noexcept
+{
+    auto next = _header->tail.load(std::memory_order_relaxed) + count;
+
+    if (next == _tailCache.capacity) [[unlikely]]
+        next = 0;
+    _header->tail.store(next, std::memory_order_release);
+}
+
+template<typename Type>
+inline Type *kF::Core::SharedSPSCQueue<Type>::peek(void) noexcept
+{
+    const auto range = peekRange(1);
+
+    return range.empty() ? nullptr : range.begin();
+}
+
+template<typename Type>
+inline kF::Core::IteratorRange<Type *> kF::Core::SharedSPSCQueue<Type>::peekRange(const std::size_t maxCount) noexcept
+{
+    const auto head = _header->head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.capacity;
+    // Readable cells are contiguous up to the tail or the end of the buffer
+    const auto contiguousCount = [head, capacity](const std::size_t tail) { return tail >= head ? tail - head : capacity - head; };
+    auto count = contiguousCount(_headCache.value);
+
+    if (count < maxCount) [[unlikely]] {
+        _headCache.value = _header->tail.load(std::memory_order_acquire);
+        count = contiguousCount(_headCache.value);
+    }
+    count = std::min(count, maxCount);
+    return IteratorRange<Type *> { _headCache.data + head, _headCache.data + head + count };
+}
+
+template<typename Type>
+inline void kF::Core::SharedSPSCQueue<Type>::release(const std::size_t count) noexcept
+{
+    auto next = _header->head.load(std::memory_order_relaxed) + count;
+
+    if (next == _headCache.capacity) [[unlikely]]
+        next = 0;
+    _header->head.store(next, std::memory_order_release);
+}
+
+template<typename Type>
+inline std::size_t kF::Core::SharedSPSCQueue<Type>::size(void) const noexcept
+{
+    const auto tail = _header->tail.load(std::memory_order_seq_cst);
+    const auto head = _header->head.load(std::memory_order_seq_cst);
+
+    return tail >= head ? tail - head : _tailCache.capacity - head + tail;
+}
\ No newline at end of file
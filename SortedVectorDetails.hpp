@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <algorithm>
 
 #include "VectorDetails.hpp"
 
@@ -159,18 +160,25 @@ public:
     inline Iterator insert(Type &&value) noexcept
         { return &push(std::move(value)); }
 
-    /** @brief Insert a range of element by iterating over iterators */
+    /** @brief Insert a range of element by iterating over iterators
+     *  Only the inserted elements are sorted, then merged in place with existing ones */
     template<std::input_iterator InputIterator>
     void insert(const InputIterator from, const InputIterator to) noexcept;
 
-    /** @brief Insert a range of element by using a map function over iterators */
+    /** @brief Insert a range of element by using a map function over iterators
+     *  Only the inserted elements are sorted, then merged in place with existing ones */
     template<std::input_iterator InputIterator, typename Map>
     void insert(const InputIterator from, const InputIterator to, Map &&map) noexcept;
 
-    /** @brief Insert a range of element by using a custom insert functor */
+    /** @brief Insert a range of element by using a custom insert functor
+     *  Only the inserted elements are sorted, then merged in place with existing ones */
     template<typename InsertFunc>
     void insertCustom(const Range count, InsertFunc &&insertFunc) noexcept;
 
+    /** @brief Insert a range of element that is already sorted, skipping the sort of inserted elements */
+    template<std::input_iterator InputIterator>
+    void insertSorted(const InputIterator from, const InputIterator to) noexcept;
+
 
     /** @brief Insert an value by copy at a specific location (no sort involved), returning its iterator */
     inline Iterator insertAt(const Iterator at, const Type &value) noexcept
@@ -215,11 +223,11 @@ public:
     Range assign(const Range index, AssignType &&value) noexcept;
 
 
-    /** @brief Finds where to insert an element */
+    /** @brief Finds where to insert an element (after every equivalent element) using a binary search */
     [[nodiscard]] inline Iterator findSortedPlacement(const Type &value) noexcept
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return std::upper_bound(DetailsBase::begin(), DetailsBase::end(), value, Compare{}); }
     [[nodiscard]] inline ConstIterator findSortedPlacement(const Type &value) const noexcept
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return std::upper_bound(DetailsBase::begin(), DetailsBase::end(), value, Compare{}); }
 
     /** @brief Comparison operators */
     [[nodiscard]] inline bool operator==(const SortedVectorDetails &other) const noexcept = default;
@@ -267,6 +275,10 @@ public:
     using DetailsBase::grow;
     using DetailsBase::toRange;
     using DetailsBase::indexOf;
+
+private:
+    /** @brief Sort the elements inserted after 'previousSize' then merge them with existing ones */
+    void mergeInserted(const Range previousSize, const bool isSorted = false) noexcept;
 };
 
 #include "SortedVectorDetails.ipp"
\ No newline at end of file
@@ -3,6 +3,8 @@
  * @ Description: SortedVectorDetails
  */
 
+#include "Assert.hpp"
+
 template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
 template<typename ...Args> requires std::constructible_from<Type, Args...>
 inline Type &kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::push(Args &&...args) noexcept
@@ -30,8 +32,9 @@ template<std::input_iterator InputIterator>
 inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::insert(
         const InputIterator from, const InputIterator to) noexcept
 {
+    const auto previousSize = DetailsBase::size();
     DetailsBase::insert(DetailsBase::end(), from, to);
-    sort();
+    mergeInserted(previousSize);
 }
 
 template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
@@ -39,8 +42,9 @@ template<std::input_iterator InputIterator, typename Map>
 inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::insert(
         const InputIterator from, const InputIterator to, Map &&map) noexcept
 {
+    const auto previousSize = DetailsBase::size();
     DetailsBase::insert(DetailsBase::end(), from, to, std::forward<Map>(map));
-    sort();
+    mergeInserted(previousSize);
 }
 
 template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
@@ -48,8 +52,38 @@ template<typename InsertFunc>
 inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::insertCustom(
         const Range count, InsertFunc &&insertFunc) noexcept
 {
+    const auto previousSize = DetailsBase::size();
     DetailsBase::insertCustom(count, std::forward<InsertFunc>(insertFunc));
-    sort();
+    mergeInserted(previousSize);
+}
+
+template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
+template<std::input_iterator InputIterator>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::insertSorted(
+        const InputIterator from, const InputIterator to) noexcept
+{
+    const auto previousSize = DetailsBase::size();
+    DetailsBase::insert(DetailsBase::end(), from, to);
+    mergeInserted(previousSize, true);
+}
+
+template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Compare, Range, IsSmallOptimized, IsRuntimeAllocated>::mergeInserted(
+        const Range previousSize, const bool isSorted) noexcept
+{
+    const auto first = DetailsBase::begin();
+    const auto middle = first + previousSize;
+    const auto last = DetailsBase::end();
+
+    if (middle == last)
+        return;
+    if (!isSorted)
+        std::sort(middle, last, Compare{});
+    else
+        kFAssert(std::is_sorted(middle, last, Compare{}), "SortedVectorDetails::insertSorted: Input range is not sorted");
+    // Skip the merge when inserted elements all go after existing ones
+    if (first != middle && Compare{}(*middle, *(middle - 1)))
+        std::inplace_merge(first, middle, last, Compare{});
 }
 
 template<typename Base, typename Type, typename Compare, std::integral Range, bool IsSmallOptimized, bool IsRuntimeAllocated>
@@ -0,0 +1,140 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SortedVectorMap
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    template<typename Key, typename Value, StaticAllocatorRequirements Allocator, typename Compare, std::integral Range>
+    class SortedVectorMap;
+}
+
+/** @brief Flat map storing its sorted keys and their values in two parallel vectors
+ *  Look-ups run a branchless binary search that only touches the key array.
+ *  Insertion and removal shift both arrays, thus the map is meant for read-mostly tables.
+ *  The compare function must not throw ! */
+template<typename Key, typename Value, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator,
+        typename Compare = std::less<Key>, std::integral Range = std::uint32_t>
+class kF::Core::SortedVectorMap
+{
+public:
+    /** @brief Sorted keys */
+    using Keys = Vector<Key, Allocator, Range>;
+
+    /** @brief Values, 'values()[i]' is the value of 'keys()[i]' */
+    using Values = Vector<Value, Allocator, Range>;
+
+
+    /** @brief Destructor */
+    inline ~SortedVectorMap(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline SortedVectorMap(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    inline SortedVectorMap(const SortedVectorMap &other) noexcept = default;
+
+    /** @brief Move constructor */
+    inline SortedVectorMap(SortedVectorMap &&other) noexcept = default;
+
+    /** @brief Build constructor from an unsorted range of key / value pairs */
+    template<std::input_iterator InputIterator>
+    inline SortedVectorMap(const InputIterator from, const InputIterator to) noexcept { build(from, to); }
+
+    /** @brief Initializer list constructor */
+    inline SortedVectorMap(std::initializer_list<std::pair<Key, Value>> &&init) noexcept
+        : SortedVectorMap(init.begin(), init.end()) {}
+
+    /** @brief Copy assignment */
+    inline SortedVectorMap &operator=(const SortedVectorMap &other) noexcept = default;
+
+    /** @brief Move assignment */
+    inline SortedVectorMap &operator=(SortedVectorMap &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    inline void swap(SortedVectorMap &other) noexcept { _keys.swap(other._keys); _values.swap(other._values); }
+
+
+    /** @brief Get the number of keys */
+    [[nodiscard]] inline Range size(void) const noexcept { return _keys.size(); }
+
+    /** @brief Check if the map is empty */
+    [[nodiscard]] inline bool empty(void) const noexcept { return _keys.empty(); }
+
+    /** @brief Get sorted keys */
+    [[nodiscard]] inline const Keys &keys(void) const noexcept { return _keys; }
+
+    /** @brief Get values, in the order of their keys */
+    [[nodiscard]] inline Values &values(void) noexcept { return _values; }
+    [[nodiscard]] inline const Values &values(void) const noexcept { return _values; }
+
+    /** @brief Get the key at a given index */
+    [[nodiscard]] inline const Key &keyAt(const Range index) const noexcept { return _keys[index]; }
+
+    /** @brief Get the value at a given index */
+    [[nodiscard]] inline Value &valueAt(const Range index) noexcept { return _values[index]; }
+    [[nodiscard]] inline const Value &valueAt(const Range index) const noexcept { return _values[index]; }
+
+
+    /** @brief Get the index of the first key not ordered before 'key', size() if none */
+    [[nodiscard]] Range lowerBound(const Key &key) const noexcept;
+
+    /** @brief Get the index of 'key', size() if not found */
+    [[nodiscard]] inline Range findIndex(const Key &key) const noexcept
+    {
+        const auto index = lowerBound(key);
+        return index != _keys.size() && !Compare{}(key, _keys[index]) ? index : _keys.size();
+    }
+
+    /** @brief Get the value of 'key', nullptr if not found */
+    [[nodiscard]] inline Value *find(const Key &key) noexcept
+        { const auto index = findIndex(key); return index != _keys.size() ? &_values[index] : nullptr; }
+    [[nodiscard]] inline const Value *find(const Key &key) const noexcept
+        { const auto index = findIndex(key); return index != _keys.size() ? &_values[index] : nullptr; }
+
+    /** @brief Check if the map contains 'key' */
+    [[nodiscard]] inline bool contains(const Key &key) const noexcept { return findIndex(key) != _keys.size(); }
+
+
+    /** @brief Insert a new key or assign the value of an existing one
+     *  @return The value of the key */
+    template<typename KeyType, typename ValueType>
+        requires std::constructible_from<Key, KeyType> && std::constructible_from<Value, ValueType>
+    Value &insertOrAssign(KeyType &&key, ValueType &&value) noexcept;
+
+    /** @brief Erase a key and its value
+     *  @return True if the key was found */
+    bool erase(const Key &key) noexcept;
+
+    /** @brief Erase the key and value at a given index */
+    inline void eraseAt(const Range index) noexcept
+        { _keys.erase(_keys.begin() + index); _values.erase(_values.begin() + index); }
+
+
+    /** @brief Replace the content of the map with an unsorted range of key / value pairs
+     *  If a key appears several times, its last value is kept */
+    template<std::input_iterator InputIterator>
+    void build(const InputIterator from, const InputIterator to) noexcept;
+
+    /** @brief Reserve memory for 'capacity' keys and values */
+    inline void reserve(const Range capacity) noexcept { _keys.reserve(capacity); _values.reserve(capacity); }
+
+    /** @brief Remove every key */
+    inline void clear(void) noexcept { _keys.clear(); _values.clear(); }
+
+    /** @brief Remove every key and release memory */
+    inline void release(void) noexcept { _keys.release(); _values.release(); }
+
+private:
+    Keys _keys {};
+    Values _values {};
+};
+
+#include "SortedVectorMap.ipp"
\ No newline at end of file
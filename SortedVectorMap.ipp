@@ -0,0 +1,84 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SortedVectorMap
+ */
+
+#include <algorithm>
+#include <tuple>
+
+#include "SortedVectorMap.hpp"
+
+template<typename Key, typename Value, kF::Core::StaticAllocatorRequirements Allocator, typename Compare, std::integral Range>
+inline Range kF::Core::SortedVectorMap<Key, Value, Allocator, Compare, Range>::lowerBound(const Key &key) const noexcept
+{
+    auto length = _keys.size();
+
+    if (!length) [[unlikely]]
+        return 0;
+    // Branchless search: the loop always runs log2(size) times and only the base moves
+    auto base = _keys.begin();
+    while (length > 1) {
+        const auto half = length / 2;
+        base += static_cast<Range>(Compare{}(base[half], key)) * half;
+        length -= half;
+    }
+    return static_cast<Range>(base - _keys.begin()) + static_cast<Range>(Compare{}(*base, key));
+}
+
+template<typename Key, typename Value, kF::Core::StaticAllocatorRequirements Allocator, typename Compare, std::integral Range>
+template<typename KeyType, typename ValueType>
+    requires std::constructible_from<Key, KeyType> && std::constructible_from<Value, ValueType>
+inline Value &kF::Core::SortedVectorMap<Key, Value, Allocator, Compare, Range>::insertOrAssign(KeyType &&key, ValueType &&value) noexcept
+{
+    const auto index = lowerBound(key);
+
+    if (index != _keys.size() && !Compare{}(key, _keys[index])) {
+        auto &target = _values[index];
+        target = std::forward<ValueType>(value);
+        return target;
+    }
+    _keys.insert(_keys.begin() + index, Key(std::forward<KeyType>(key)));
+    return *_values.insert(_values.begin() + index, Value(std::forward<ValueType>(value)));
+}
+
+template<typename Key, typename Value, kF::Core::StaticAllocatorRequirements Allocator, typename Compare, std::integral Range>
+inline bool kF::Core::SortedVectorMap<Key, Value, Allocator, Compare, Range>::erase(const Key &key) noexcept
+{
+    const auto index = findIndex(key);
+
+    if (index == _keys.size())
+        return false;
+    eraseAt(index);
+    return true;
+}
+
+template<typename Key, typename Value, kF::Core::StaticAllocatorRequirements Allocator, typename Compare, std::integral Range>
+template<std::input_iterator InputIterator>
+inline void kF::Core::SortedVectorMap<Key, Value, Allocator, Compare, Range>::build(const InputIterator from, const InputIterator to) noexcept
+{
+    Keys keys;
+    Values values;
+
+    for (auto it = from; it != to; ++it) {
+        auto &&pair = *it;
+        keys.push(std::get<0>(std::forward<decltype(pair)>(pair)));
+        values.push(std::get<1>(std::forward<decltype(pair)>(pair)));
+    }
+
+    // Sort a permutation so that keys and values are moved only once, stable to keep the last duplicated key
+    Vector<Range, Allocator, Range> order(keys.size(), [](const Range index) { return index; });
+    std::stable_sort(order.begin(), order.end(), [&keys](const Range lhs, const Range rhs) {
+        return Compare{}(keys[lhs], keys[rhs]);
+    });
+
+    clear();
+    reserve(order.size());
+    for (const auto index : order) {
+        if (!_keys.empty() && !Compare{}(_keys.back(), keys[index])) {
+            _values.back() = std::move(values[index]);
+        } else {
+            _keys.push(std::move(keys[index]));
+            _values.push(std::move(values[index]));
+        }
+    }
+}
\ No newline at end of file
@@ -16,7 +16,9 @@ namespace kF::Core
 }
 
 /** @brief The sparse index set is a container which provide O(1) look-up time at the cost of non-efficient memory consumption
+ *  Each page counts its live elements and is released as soon as its last element is removed
  *  @note This implementation is not aware of which index is initialized the user must manage lifecycle **carefully**
+ *  Every 'add' must be paired with exactly one 'remove' or 'extract' to keep page counts valid
  *  If you wish to ensure initialization of */
 template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::integral Range = std::uint32_t, auto Initializer = nullptr>
     requires (Initializer == nullptr || std::is_invocable_v<decltype(Initializer), Type *, Type *>)
@@ -30,6 +32,7 @@ public:
     struct alignas(alignof(Type)) Page
     {
         std::uint8_t data[PageSize * sizeof(Type)];
+        Range count {};
     };
 
     /** @brief Pointer over page */
@@ -63,7 +66,15 @@ public:
 
 
     /** @brief Check if the page of an index exists */
-    [[nodiscard]] inline bool pageExists(const Range index) const noexcept { return _pages.size() > GetPageIndex(index); }
+    [[nodiscard]] inline bool pageExists(const Range index) const noexcept
+        { const auto pageIndex = GetPageIndex(index); return _pages.size() > pageIndex && _pages[pageIndex]; }
+
+    /** @brief Get the number of live elements inside the page of an index */
+    [[nodiscard]] inline Range pageOccupancy(const Range index) const noexcept
+        { return pageExists(index) ? _pages[GetPageIndex(index)]->count : Range(0); }
+
+    /** @brief Get the number of allocated pages */
+    [[nodiscard]] Range pageCount(void) const noexcept;
 
 
     /** @brief Add a new value to the set */
@@ -100,6 +111,10 @@ public:
         { return reinterpret_cast<const Type *>(_pages[pageIndex].get())[elementIndex]; }
 
 
+    /** @brief Trim trailing released pages from the page list */
+    void shrinkToFit(void) noexcept;
+
+
     /** @brief Release all memory without calling any Type destructors */
     inline void clearUnsafe(void) noexcept { _pages.clear(); }
 
@@ -108,6 +123,9 @@ public:
 
 private:
     Core::Vector<PagePtr, Allocator, Range> _pages {};
+
+    /** @brief Decrement the live count of a page, releasing it once empty */
+    void releaseElement(const Range pageIndex) noexcept;
 };
 
 #include "SparseSet.ipp"
\ No newline at end of file
@@ -3,6 +3,8 @@
  * @ Description: Sparse set
  */
 
+#include <algorithm>
+
 #include "Assert.hpp"
 #include "SparseSet.hpp"
 
@@ -23,6 +25,7 @@ inline Type &kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>:
             Initializer(reinterpret_cast<Type *>(page.get()), reinterpret_cast<Type *>(page.get()) + PageSize);
     }
 
+    ++page->count;
     return *new (&at(pageIndex, elementIndex)) Type(std::forward<Args>(args)...);
 }
 
@@ -35,6 +38,7 @@ inline void kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>::
         ref.~Type();
     if constexpr (HasInitializer)
         Initializer(&ref, &ref + 1);
+    releaseElement(pageIndex);
 }
 
 template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range, auto Initializer>
@@ -48,5 +52,38 @@ inline Type kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>::
         ref.~Type();
     if constexpr (HasInitializer)
         Initializer(&ref, &ref + 1);
+    releaseElement(pageIndex);
     return value;
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range, auto Initializer>
+    requires (Initializer == nullptr || std::is_invocable_v<decltype(Initializer), Type *, Type *>)
+inline void kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>::releaseElement(const Range pageIndex) noexcept
+{
+    auto &page = _pages[pageIndex];
+
+    kFAssert(page->count, "SparseSet::releaseElement: Page ", pageIndex, " is already empty");
+    if (!--page->count)
+        page.release();
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range, auto Initializer>
+    requires (Initializer == nullptr || std::is_invocable_v<decltype(Initializer), Type *, Type *>)
+inline Range kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>::pageCount(void) const noexcept
+{
+    return static_cast<Range>(std::count_if(_pages.begin(), _pages.end(), [](const auto &page) { return static_cast<bool>(page); }));
+}
+
+template<typename Type, std::size_t PageSize, kF::Core::StaticAllocatorRequirements Allocator, std::integral Range, auto Initializer>
+    requires (Initializer == nullptr || std::is_invocable_v<decltype(Initializer), Type *, Type *>)
+inline void kF::Core::SparseSet<Type, PageSize, Allocator, Range, Initializer>::shrinkToFit(void) noexcept
+{
+    auto end = _pages.end();
+
+    while (end != _pages.begin() && !*(end - 1))
+        --end;
+    if (end == _pages.begin())
+        _pages.release();
+    else
+        _pages.erase(end, _pages.end());
 }
\ No newline at end of file
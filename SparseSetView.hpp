@@ -0,0 +1,74 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sparse set view
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include "Parallel.hpp"
+#include "PackedSparseSet.hpp"
+
+namespace kF::Core
+{
+    template<typename ...Sets>
+    class SparseSetView;
+}
+
+/** @brief View over the sparse indexes present in every packed sparse set of 'Sets'
+ *  Iteration walks the dense index array of the smallest set and probes the others in O(1).
+ *  Pages of upcoming indexes are prefetched 'PrefetchDistance' elements ahead.
+ *  Sets must not be modified while iterated. */
+template<typename ...Sets>
+class kF::Core::SparseSetView
+{
+public:
+    static_assert(sizeof...(Sets) >= 1, "SparseSetView: At least one set is required");
+
+    /** @brief Number of elements between the probed index and the prefetched one */
+    static constexpr std::size_t PrefetchDistance = 8;
+
+    /** @brief Number of sets */
+    static constexpr std::size_t SetCount = sizeof...(Sets);
+
+
+    /** @brief Construct the view over a list of sets */
+    inline SparseSetView(Sets &...sets) noexcept : _sets(sets...) {}
+
+
+    /** @brief Get the index of the smallest set, whose dense indexes are iterated */
+    [[nodiscard]] std::size_t leadSet(void) const noexcept;
+
+    /** @brief Get the maximum number of sparse indexes present in every set */
+    [[nodiscard]] std::size_t sizeHint(void) const noexcept;
+
+
+    /** @brief Invoke 'callable(index, values...)' for each sparse index present in every set */
+    template<typename Callable>
+    void each(Callable &&callable) const noexcept;
+
+    /** @brief Invoke 'callable(index, values...)' for each sparse index present in every set in parallel
+     *  The dense indexes of the smallest set are split into chunks processed concurrently
+     *  @param grainSize Minimum number of probed indexes per task, deduced if null */
+    template<kF::Core::StaticAllocatorRequirements Allocator, typename Callable>
+    void parallelEach(Scheduler<Allocator> &scheduler, Callable &&callable, const std::size_t grainSize = 0ul) const noexcept;
+
+    /** @brief Invoke 'callable(index, values...)' for each sparse index present in every set in parallel, using the shared scheduler */
+    template<typename Callable>
+    inline void parallelEach(Callable &&callable, const std::size_t grainSize = 0ul) const noexcept
+        { parallelEach(SharedScheduler(), std::forward<Callable>(callable), grainSize); }
+
+private:
+    std::tuple<Sets &...> _sets;
+
+    /** @brief Visit the dense range [begin, end[ of the lead set */
+    template<typename Callable>
+    void eachRange(const std::size_t lead, const std::size_t begin, const std::size_t end, Callable &callable) const noexcept;
+
+    /** @brief Visit the dense range [begin, end[ of a compile-time lead set */
+    template<std::size_t Lead, typename Callable, std::size_t ...Indexes>
+    void eachRangeImpl(const std::size_t begin, const std::size_t end, Callable &callable, std::index_sequence<Indexes...>) const noexcept;
+};
+
+#include "SparseSetView.ipp"
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sparse set view
+ */
+
+#include "SparseSetView.hpp"
+
+template<typename ...Sets>
+inline std::size_t kF::Core::SparseSetView<Sets...>::leadSet(void) const noexcept
+{
+    return [this]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        const std::size_t sizes[] { static_cast<std::size_t>(std::get<Indexes>(_sets).size())... };
+        std::size_t lead = 0;
+        for (std::size_t i = 1; i != SetCount; ++i) {
+            if (sizes[i] < sizes[lead])
+                lead = i;
+        }
+        return lead;
+    }(std::index_sequence_for<Sets...> {});
+}
+
+template<typename ...Sets>
+inline std::size_t kF::Core::SparseSetView<Sets...>::sizeHint(void) const noexcept
+{
+    return std::apply([](const auto &...sets) {
+        return std::min({ static_cast<std::size_t>(sets.size())... });
+    }, _sets);
+}
+
+template<typename ...Sets>
+template<typename Callable>
+inline void kF::Core::SparseSetView<Sets...>::each(Callable &&callable) const noexcept
+{
+    const auto lead = leadSet();
+
+    eachRange(lead, 0, sizeHint(), callable);
+}
+
+template<typename ...Sets>
+template<kF::Core::StaticAllocatorRequirements Allocator, typename Callable>
+inline void kF::Core::SparseSetView<Sets...>::parallelEach(Scheduler<Allocator> &scheduler, Callable &&callable, const std::size_t grainSize) const noexcept
+{
+    const auto lead = leadSet();
+    const auto size = sizeHint();
+
+    Internal::ParallelChunks(scheduler, size, Internal::ParallelGrainSize(scheduler, size, grainSize),
+        [this, lead, &callable](const std::size_t, const std::size_t begin, const std::size_t end) {
+            eachRange(lead, begin, end, callable);
+        }
+    );
+}
+
+template<typename ...Sets>
+template<typename Callable>
+inline void kF::Core::SparseSetView<Sets...>::eachRange(const std::size_t lead, const std::size_t begin, const std::size_t end, Callable &callable) const noexcept
+{
+    [this, lead, begin, end, &callable]<std::size_t ...Indexes>(std::index_sequence<Indexes...> sequence) {
+        static_cast<void>(((lead == Indexes ? (eachRangeImpl<Indexes>(begin, end, callable, sequence), true) : false) || ...));
+    }(std::index_sequence_for<Sets...> {});
+}
+
+template<typename ...Sets>
+template<std::size_t Lead, typename Callable, std::size_t ...Indexes>
+inline void kF::Core::SparseSetView<Sets...>::eachRangeImpl(const std::size_t begin, const std::size_t end, Callable &callable, std::index_sequence<Indexes...>) const noexcept
+{
+    const auto leadIndexes = std::get<Lead>(_sets).indexes().begin();
+    const auto prefetchEnd = end > PrefetchDistance ? end - PrefetchDistance : 0ul;
+
+    for (auto i = begin; i != end; ++i) {
+        // Prefetch the page entries of an upcoming index in every other set
+        if (i < prefetchEnd) [[likely]] {
+            const auto next = leadIndexes[i + PrefetchDistance];
+            ([&next](const auto &set) {
+                using Set = std::remove_cvref_t<decltype(set)>;
+                if (const auto page = set.page(Set::GetPageIndex(next)); page)
+                    Prefetch(page->data + Set::GetElementIndex(next));
+            }(std::get<Indexes>(_sets)), ...);
+        }
+
+        // Probe every set, stopping at the first miss
+        const auto index = leadIndexes[i];
+        std::size_t dense[SetCount];
+        const bool found = ((Indexes == Lead
+            ? (dense[Indexes] = i, true)
+            : (dense[Indexes] = std::get<Indexes>(_sets).denseIndex(index)) != std::remove_cvref_t<decltype(std::get<Indexes>(_sets))>::NullIndex) && ...);
+        if (found)
+            callable(index, std::get<Indexes>(_sets).values()[dense[Indexes]]...);
+    }
+}
\ No newline at end of file
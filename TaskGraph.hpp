@@ -0,0 +1,93 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Task graph
+ */
+
+#pragma once
+
+#include "Scheduler.hpp"
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    template<kF::Core::StaticAllocatorRequirements Allocator>
+    class TaskGraph;
+}
+
+/**
+ * @brief A task graph is a directed acyclic graph of tasks executed over a scheduler
+ * Each node counts its dependencies, a finished node schedules every successor whose count reaches zero.
+ * Successors scheduled from workers go through their work stealing deques so independent branches overlap.
+ * The graph is reusable: running it again only resets the dependency counters without allocating.
+ * @note The graph must be acyclic and must not be modified nor ran concurrently while running
+ *
+ * @tparam Allocator Static allocator
+ */
+template<kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class kF::Core::TaskGraph
+{
+public:
+    /** @brief Task functor */
+    using Task = Functor<void(void), Allocator>;
+
+    /** @brief Index of a node */
+    using NodeIndex = std::uint32_t;
+
+    /** @brief Node of the graph */
+    struct Node
+    {
+        Task task {};
+        Vector<NodeIndex, Allocator> successors {};
+        std::uint32_t dependencyCount { 0u };
+    };
+
+
+    /** @brief Destructor */
+    inline ~TaskGraph(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline TaskGraph(void) noexcept = default;
+
+
+    /** @brief Add a node to the graph */
+    template<typename Callable>
+    NodeIndex add(Callable &&callable) noexcept;
+
+    /** @brief Make 'after' depend on 'before' */
+    void precede(const NodeIndex before, const NodeIndex after) noexcept;
+
+    /** @brief Remove every node of the graph */
+    void clear(void) noexcept;
+
+
+    /** @brief Run the graph over 'scheduler' and wait for its completion
+     *  The calling thread helps executing tasks while waiting */
+    void run(Scheduler<Allocator> &scheduler) noexcept;
+
+
+    /** @brief Get the number of nodes */
+    [[nodiscard]] inline NodeIndex nodeCount(void) const noexcept { return _nodes.size(); }
+
+    /** @brief Get a node */
+    [[nodiscard]] inline const Node &node(const NodeIndex index) const noexcept { return _nodes[index]; }
+
+
+private:
+    Vector<Node, Allocator> _nodes {};
+    HeapArray<std::atomic<std::uint32_t>, Allocator, NodeIndex> _pendingDependencies {};
+    Scheduler<Allocator> *_scheduler {};
+    alignas_cacheline std::atomic<NodeIndex> _remainingNodes { 0u };
+
+
+    /** @brief Copy and move constructors disabled */
+    TaskGraph(const TaskGraph &other) = delete;
+    TaskGraph(TaskGraph &&other) = delete;
+
+    /** @brief Execute a node and schedule its ready successors */
+    void executeNode(const NodeIndex index) noexcept;
+
+    /** @brief Schedule a ready node */
+    void scheduleNode(const NodeIndex index) noexcept;
+};
+
+#include "TaskGraph.ipp"
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Task graph
+ */
+
+#include "Abort.hpp"
+#include "Assert.hpp"
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callable>
+inline typename kF::Core::TaskGraph<Allocator>::NodeIndex kF::Core::TaskGraph<Allocator>::add(Callable &&callable) noexcept
+{
+    const auto index = _nodes.size();
+
+    _nodes.push(Node { .task = Task(std::forward<Callable>(callable)) });
+    return index;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::TaskGraph<Allocator>::precede(const NodeIndex before, const NodeIndex after) noexcept
+{
+    kFAssert(before < _nodes.size() && after < _nodes.size() && before != after,
+        "Core::TaskGraph::precede: Invalid edge ", before, " -> ", after);
+    _nodes[before].successors.push(after);
+    ++_nodes[after].dependencyCount;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::TaskGraph<Allocator>::clear(void) noexcept
+{
+    _nodes.clear();
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::TaskGraph<Allocator>::run(Scheduler<Allocator> &scheduler) noexcept
+{
+    const auto count = _nodes.size();
+
+    if (!count)
+        return;
+    // Counters are only reallocated when the graph grew since last run
+    if (_pendingDependencies.size() < count)
+        _pendingDependencies.allocate(count);
+    for (auto i = 0u; i != count; ++i)
+        _pendingDependencies[i].store(_nodes[i].dependencyCount, std::memory_order_relaxed);
+    _scheduler = &scheduler;
+    _remainingNodes.store(count, std::memory_order_relaxed);
+
+    bool hasRoot = false;
+    for (auto i = 0u; i != count; ++i) {
+        if (!_nodes[i].dependencyCount) {
+            hasRoot = true;
+            scheduleNode(i);
+        }
+    }
+    kFEnsure(hasRoot, "Core::TaskGraph::run: Graph has no root node, it must contain a cycle");
+    while (_remainingNodes.load(std::memory_order_acquire)) {
+        if (!scheduler.executeOne())
+            std::this_thread::yield();
+    }
+    _scheduler = nullptr;
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::TaskGraph<Allocator>::executeNode(const NodeIndex index) noexcept
+{
+    auto &node = _nodes[index];
+
+    node.task();
+    for (const auto successor : node.successors) {
+        // The last dependency to finish schedules the successor
+        if (_pendingDependencies[successor].fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+            scheduleNode(successor);
+    }
+    _remainingNodes.fetch_sub(1u, std::memory_order_release);
+}
+
+template<kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::Core::TaskGraph<Allocator>::scheduleNode(const NodeIndex index) noexcept
+{
+    _scheduler->schedule([this, index] { executeNode(index); });
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Atomic shared pointer unit tests
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/AtomicSharedPtr.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Config
+    {
+        static inline std::atomic<int> Alive = 0;
+
+        int version {};
+        int checksum {};
+
+        Config(void) noexcept { ++Alive; }
+        Config(const int version_) noexcept : version(version_), checksum(version_ * 3) { ++Alive; }
+        ~Config(void) noexcept { --Alive; }
+    };
+
+    using ConfigPtr = Core::SharedPtr<Config>;
+
+    constexpr auto Bias = Core::AtomicSharedPtr<Config>::PublicationBias;
+}
+
+TEST(AtomicSharedPtr, Basics)
+{
+    {
+        Core::AtomicSharedPtr<Config> atomic;
+        ASSERT_FALSE(atomic.load());
+
+        atomic.store(ConfigPtr::Make(1));
+        auto first = atomic.load();
+        ASSERT_TRUE(first);
+        ASSERT_EQ(first->version, 1);
+        // Acquired references are transferred into the shared count when the pointer is replaced
+        ASSERT_EQ(first.referenceCount(), Bias);
+
+        auto previous = atomic.exchange(ConfigPtr::Make(2));
+        ASSERT_EQ(previous, first);
+        ASSERT_EQ(first.referenceCount(), 2);
+        previous.release();
+        first.release();
+        ASSERT_EQ(Config::Alive, 1);
+
+        auto expected = ConfigPtr::Make(42);
+        auto desired = ConfigPtr::Make(3);
+        ASSERT_FALSE(atomic.compareExchange(expected, std::move(desired)));
+        ASSERT_EQ(expected->version, 2);
+        ASSERT_TRUE(desired);
+        ASSERT_TRUE(atomic.compareExchange(expected, std::move(desired)));
+        ASSERT_FALSE(desired);
+        ASSERT_EQ(expected.referenceCount(), 1);
+        ASSERT_EQ(atomic.load()->version, 3);
+        ASSERT_EQ(Config::Alive, 2);
+        expected.release();
+        ASSERT_EQ(Config::Alive, 1);
+    }
+    ASSERT_EQ(Config::Alive, 0);
+}
+
+TEST(AtomicSharedPtr, Borrow)
+{
+    {
+        Core::AtomicSharedPtr<Config> atomic;
+        ASSERT_FALSE(atomic.borrow());
+
+        atomic.store(ConfigPtr::Make(1));
+        {
+            const auto borrow = atomic.borrow();
+            ASSERT_TRUE(borrow);
+            ASSERT_EQ(borrow->version, 1);
+            // Borrowing and loading don't touch the shared count
+            ASSERT_EQ(atomic.load().referenceCount(), Bias);
+            // The borrowed data outlives its replacement
+            atomic.store(ConfigPtr::Make(2));
+            ASSERT_EQ(Config::Alive, 2);
+            ASSERT_EQ((*borrow).checksum, 3);
+            ASSERT_EQ(atomic.borrow()->version, 2);
+        }
+        ASSERT_EQ(Config::Alive, 1);
+        {
+            const auto first = atomic.borrow();
+            const auto second = atomic.borrow();
+            ASSERT_EQ(first.get(), second.get());
+        }
+        // Released borrows are only balanced once their acquired count gets transferred
+        const auto last = atomic.exchange(ConfigPtr {});
+        ASSERT_EQ(last.referenceCount(), 1);
+    }
+    ASSERT_EQ(Config::Alive, 0);
+}
+
+TEST(AtomicSharedPtr, ReplacedThenRestored)
+{
+    {
+        const auto first = ConfigPtr::Make(1);
+        const auto second = ConfigPtr::Make(2);
+        Core::AtomicSharedPtr<Config> atomic(ConfigPtr { first });
+        {
+            // The borrow is still held when its pointer gets published again
+            const auto borrow = atomic.borrow();
+            atomic.store(second);
+            atomic.store(first);
+            ASSERT_EQ(borrow->version, 1);
+            auto expected = atomic.load();
+            ASSERT_TRUE(atomic.compareExchange(expected, ConfigPtr { second }));
+            ASSERT_TRUE(atomic.compareExchange(expected = second, ConfigPtr { first }));
+        }
+        atomic.store(ConfigPtr {});
+        ASSERT_EQ(first.referenceCount(), 1);
+        ASSERT_EQ(second.referenceCount(), 1);
+    }
+    ASSERT_EQ(Config::Alive, 0);
+}
+
+TEST(AtomicSharedPtr, FoldAcquired)
+{
+    {
+        const auto first = ConfigPtr::Make(1);
+        Core::AtomicSharedPtr<Config> atomic(ConfigPtr { first });
+        Core::AtomicSharedPtr<Config> empty;
+        std::vector<ConfigPtr> loaded;
+
+        // Acquired counts are folded before overflowing the packed state
+        for (auto i = 0u; i != 3u * Core::AtomicSharedPtr<Config>::FoldThreshold; ++i) {
+            loaded.push_back(atomic.load());
+            ASSERT_FALSE(empty.borrow());
+        }
+        ASSERT_EQ(atomic.borrow()->version, 1);
+        atomic.store(ConfigPtr {});
+        ASSERT_EQ(first.referenceCount(), loaded.size() + 1);
+        loaded.clear();
+        ASSERT_EQ(first.referenceCount(), 1);
+    }
+    ASSERT_EQ(Config::Alive, 0);
+}
+
+TEST(AtomicSharedPtr, HotSwap)
+{
+    constexpr auto ReaderCount = 3;
+    constexpr auto Swaps = 5000;
+
+    {
+        Core::AtomicSharedPtr<Config> atomic(ConfigPtr::Make(0));
+        std::atomic<bool> running { true };
+        std::vector<std::thread> readers;
+
+        for (auto i = 0; i != ReaderCount; ++i) {
+            readers.emplace_back([&atomic, &running] {
+                auto last = 0;
+                while (running.load(std::memory_order_relaxed)) {
+                    const auto config = atomic.load();
+                    ASSERT_EQ(config->checksum, config->version * 3);
+                    ASSERT_GE(config->version, last);
+                    last = config->version;
+                    const auto borrow = atomic.borrow();
+                    ASSERT_EQ(borrow->checksum, borrow->version * 3);
+                    ASSERT_GE(borrow->version, last);
+                    last = borrow->version;
+                }
+            });
+        }
+        for (auto i = 1; i <= Swaps; ++i) {
+            if (i % 2)
+                atomic.store(ConfigPtr::Make(i));
+            else {
+                auto expected = atomic.load();
+                ASSERT_TRUE(atomic.compareExchange(expected, ConfigPtr::Make(i)));
+            }
+        }
+        running = false;
+        for (auto &reader : readers)
+            reader.join();
+        ASSERT_EQ(atomic.load()->version, Swaps);
+        ASSERT_EQ(Config::Alive, 1);
+    }
+    ASSERT_EQ(Config::Alive, 0);
+}
\ No newline at end of file
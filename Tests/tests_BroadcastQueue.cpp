@@ -0,0 +1,112 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the broadcast queue
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/BroadcastQueue.hpp>
+
+using namespace kF;
+
+TEST(BroadcastQueue, SinglePushPop)
+{
+    constexpr std::size_t Capacity = 8;
+
+    Core::BroadcastQueue<std::string> queue(Capacity, 2);
+    std::string str;
+
+    ASSERT_EQ(queue.capacity(), Capacity);
+    ASSERT_EQ(queue.consumerCount(), 2);
+    ASSERT_FALSE(queue.tryPop(0, str));
+    for (auto i = 0ul; i < Capacity; ++i)
+        ASSERT_TRUE(queue.tryPush(std::to_string(i)));
+    ASSERT_FALSE(queue.tryPush("full"));
+    // Every consumer sees every element
+    for (auto i = 0ul; i < Capacity; ++i) {
+        ASSERT_TRUE(queue.tryPop(0, str));
+        ASSERT_EQ(str, std::to_string(i));
+    }
+    ASSERT_FALSE(queue.tryPop(0, str));
+    // Producer is gated by the slowest consumer
+    ASSERT_FALSE(queue.tryPush("full"));
+    ASSERT_EQ(queue.available(1), Capacity);
+    ASSERT_EQ(queue.consume(1, [](const std::string &) {}, 3), 3);
+    for (auto i = 0ul; i < 3; ++i)
+        ASSERT_TRUE(queue.tryPush(std::to_string(Capacity + i)));
+    ASSERT_FALSE(queue.tryPush("full"));
+    ASSERT_EQ(queue.available(0), 3);
+    ASSERT_EQ(queue.available(1), Capacity);
+}
+
+TEST(BroadcastQueue, BatchClaimPublish)
+{
+    Core::BroadcastQueue<std::size_t> queue(16, 1);
+    std::size_t sequence;
+
+    ASSERT_TRUE(queue.tryClaim(10, sequence));
+    ASSERT_EQ(sequence, 0);
+    for (auto i = 0ul; i < 10; ++i)
+        queue.at(sequence + i) = i;
+    ASSERT_EQ(queue.available(0), 0);
+    queue.publish();
+    ASSERT_EQ(queue.available(0), 10);
+    ASSERT_FALSE(queue.tryClaim(7, sequence));
+    std::size_t expected = 0;
+    ASSERT_EQ(queue.consume(0, [&expected](const std::size_t value) { ASSERT_EQ(value, expected++); }), 10);
+    ASSERT_TRUE(queue.tryClaim(16, sequence));
+    ASSERT_EQ(sequence, 10);
+}
+
+template<typename WaitStrategy>
+static void TestIntensiveThreading(void)
+{
+    constexpr auto ConsumerCount = KUBE_DEBUG_BUILD ? 2ul : 4ul;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 65536ul : 1048576ul;
+    constexpr auto Batch = 16ul;
+
+    Core::BroadcastQueue<std::size_t, WaitStrategy> queue(1024, ConsumerCount);
+    std::vector<std::thread> consumers(ConsumerCount);
+    std::vector<std::size_t> sums(ConsumerCount);
+
+    for (auto i = 0ul; i < ConsumerCount; ++i) {
+        consumers[i] = std::thread([&queue, &sums, i] {
+            std::size_t count = 0, sum = 0;
+            while (count != Counter) {
+                [[maybe_unused]] const auto available = queue.waitAvailable(i);
+                count += queue.consume(i, [&sum](const std::size_t value) { sum += value; });
+            }
+            sums[i] = sum;
+        });
+    }
+    for (auto i = 0ul; i < Counter; i += Batch) {
+        const auto sequence = queue.claim(Batch);
+        for (auto j = 0ul; j < Batch; ++j)
+            queue.at(sequence + j) = i + j;
+        queue.publish();
+    }
+    for (auto &thd : consumers)
+        thd.join();
+    for (const auto sum : sums)
+        ASSERT_EQ(sum, Counter * (Counter - 1) / 2);
+}
+
+TEST(BroadcastQueue, IntensiveThreadingBusySpin)
+{
+    TestIntensiveThreading<Core::BusySpinWaitStrategy>();
+}
+
+TEST(BroadcastQueue, IntensiveThreadingYield)
+{
+    TestIntensiveThreading<Core::YieldWaitStrategy>();
+}
+
+TEST(BroadcastQueue, IntensiveThreadingFutex)
+{
+    TestIntensiveThreading<Core::FutexWaitStrategy>();
+}
\ No newline at end of file
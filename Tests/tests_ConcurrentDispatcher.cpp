@@ -0,0 +1,118 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Concurrent dispatcher unit tests
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/ConcurrentDispatcher.hpp>
+
+using namespace kF;
+
+struct Foo
+{
+    int memberFunction(const int x, const int y)
+    { return x * y; }
+
+    [[nodiscard]] static int FreeFunction(const int x, const int y)
+        { return x * y; }
+};
+
+TEST(ConcurrentDispatcher, Basics)
+{
+    Core::ConcurrentDispatcher<int(int, int)> dispatcher;
+    Foo foo;
+
+    auto handle1 = dispatcher.add<&Foo::memberFunction>(&foo);
+    auto handle2 = dispatcher.add<&Foo::FreeFunction>();
+    auto handle3 = dispatcher.add([](int x, int y) {
+        return x * y;
+    });
+    ASSERT_EQ(dispatcher.count(), 3);
+    auto i = 0u;
+    dispatcher.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
+    ASSERT_EQ(i, 3);
+    handle1 = {};
+    handle2 = {};
+    i = 0;
+    dispatcher.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
+    ASSERT_EQ(i, 1);
+    handle1 = dispatcher.add<&Foo::FreeFunction>();
+    i = 0;
+    dispatcher.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
+    ASSERT_EQ(i, 2);
+    handle1 = {};
+    handle2 = {};
+    handle3 = {};
+    i = 0;
+    dispatcher.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
+    ASSERT_EQ(i, 0);
+}
+
+TEST(ConcurrentDispatcher, Semantics)
+{
+    auto value = std::make_shared<int>(0);
+    Core::DispatcherSlot self;
+
+    {
+        Core::ConcurrentDispatcher<void(int &)> dispatcher;
+        auto handle = dispatcher.add([value](int &x) { x += *value; });
+        ASSERT_EQ(value.use_count(), 2);
+        auto dispatcher2 = std::move(dispatcher);
+        // Slots may outlive their dispatcher
+        dispatcher2 = {};
+        ASSERT_EQ(value.use_count(), 2);
+    }
+    ASSERT_EQ(value.use_count(), 1);
+
+    // A slot may disconnect itself while being dispatched
+    Core::ConcurrentDispatcher<void(int &)> dispatcher;
+    self = dispatcher.add([&self](int &x) { ++x; self = {}; });
+    auto x = 0;
+    dispatcher.dispatch(x);
+    dispatcher.dispatch(x);
+    ASSERT_EQ(x, 1);
+    ASSERT_EQ(dispatcher.count(), 0);
+}
+
+TEST(ConcurrentDispatcher, IntensiveThreading)
+{
+    constexpr auto SlotCount = 64;
+    constexpr auto Iterations = 2000;
+
+    Core::ConcurrentDispatcher<void(std::size_t &)> dispatcher;
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> alive { 0 };
+    Core::DispatcherSlot stable = dispatcher.add([](std::size_t &x) { ++x; });
+
+    std::thread writer([&] {
+        std::vector<Core::DispatcherSlot> slots;
+        for (auto i = 0; i < Iterations; ++i) {
+            if (slots.size() == SlotCount || (i % 3 == 2 && !slots.empty())) {
+                slots.pop_back();
+            } else {
+                ++alive;
+                slots.push_back(dispatcher.add([guard = std::shared_ptr<void>(nullptr, [&alive](void *) { --alive; })](std::size_t &) {}));
+            }
+        }
+        slots.clear();
+        running = false;
+    });
+
+    std::size_t dispatched = 0;
+    while (running) {
+        std::size_t x = 0;
+        dispatcher.dispatch(x);
+        ASSERT_EQ(x, 1);
+        ++dispatched;
+    }
+    writer.join();
+    ASSERT_GT(dispatched, 0);
+    ASSERT_EQ(dispatcher.count(), 1);
+    ASSERT_EQ(alive, 0);
+}
\ No newline at end of file
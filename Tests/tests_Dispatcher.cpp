@@ -3,6 +3,9 @@
  * @ Description: Trivial functor unit tests
  */
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <Kube/Core/TrivialDispatcher.hpp>
@@ -102,4 +105,24 @@ TEST(Dispatcher, Semantics)
     i = 0;
     dispatcher2.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
     ASSERT_EQ(i, 3);
-}
\ No newline at end of file
+}
+
+TEST(Dispatcher, Grouping)
+{
+    Core::Dispatcher<void(std::vector<int> &)> dispatcher;
+
+    for (auto i = 0; i < 30; ++i) {
+        if (i % 2)
+            dispatcher.add([](std::vector<int> &out) { out.push_back(1); });
+        else
+            dispatcher.add([ptr = std::make_unique<int>(2)](std::vector<int> &out) { out.push_back(*ptr); });
+    }
+    ASSERT_EQ(dispatcher.count(), 30);
+    std::vector<int> out;
+    dispatcher.dispatch(out);
+    ASSERT_EQ(out.size(), 30);
+    for (auto i = 0; i < 15; ++i) {
+        ASSERT_EQ(out[i], 2);
+        ASSERT_EQ(out[i + 15], 1);
+    }
+}
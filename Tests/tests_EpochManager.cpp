@@ -0,0 +1,146 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Epoch manager unit tests
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/EpochManager.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Node
+    {
+        static inline std::atomic<int> Alive = 0;
+
+        int value {};
+        Node *next {};
+
+        Node(const int value_) noexcept : value(value_) { ++Alive; }
+        ~Node(void) noexcept { --Alive; }
+    };
+
+    [[nodiscard]] Node *MakeNode(const int value) noexcept
+        { return new (Core::DefaultStaticAllocator::Allocate(sizeof(Node), alignof(Node))) Node(value); }
+}
+
+TEST(EpochManager, Basics)
+{
+    {
+        Core::EpochManager manager;
+        auto &reader = manager.registerThread();
+        auto &writer = manager.registerThread();
+        ASSERT_NE(&reader, &writer);
+
+        {
+            Core::EpochGuard readerGuard(reader);
+            {
+                // Guards can be nested
+                Core::EpochGuard nested(reader);
+            }
+            ASSERT_EQ(reader.epoch.load(), manager.epoch());
+
+            manager.retire(writer, MakeNode(1));
+            ASSERT_EQ(manager.pendingCount(writer), 1);
+            // The epoch can't move more than once past the reader, the node stays alive
+            for (auto i = 0; i != 10; ++i)
+                manager.collect(writer);
+            ASSERT_EQ(manager.pendingCount(writer), 1);
+            ASSERT_EQ(Node::Alive, 1);
+        }
+        ASSERT_EQ(reader.epoch.load(), Core::EpochManager::InactiveEpoch);
+        manager.collect(writer);
+        manager.collect(writer);
+        ASSERT_EQ(manager.pendingCount(writer), 0);
+        ASSERT_EQ(Node::Alive, 0);
+
+        // Pending nodes of an unregistered participant are freed by the manager
+        manager.retire(writer, MakeNode(2));
+        manager.unregisterThread(writer);
+        manager.unregisterThread(reader);
+        ASSERT_EQ(Node::Alive, 1);
+        // Free records are reused
+        auto &reused = manager.registerThread();
+        ASSERT_TRUE(&reused == &reader || &reused == &writer);
+        manager.unregisterThread(reused);
+    }
+    ASSERT_EQ(Node::Alive, 0);
+}
+
+TEST(EpochManager, ThreadParticipant)
+{
+    auto &manager = Core::SharedEpochManager();
+    Core::EpochManager::Participant *participant {};
+
+    std::thread thread([&manager, &participant] {
+        Core::EpochGuard guard;
+        participant = &guard.participant();
+        ASSERT_TRUE(participant->threadOwned);
+        ASSERT_EQ(&manager.threadParticipant(), participant);
+        guard.retire(MakeNode(0));
+    });
+    thread.join();
+    // The thread exit unregistered its participant
+    ASSERT_FALSE(participant->registered.load());
+    ASSERT_FALSE(participant->threadOwned);
+    ASSERT_EQ(&manager.registerThread(), participant);
+    // The shared manager is never destroyed before the end of the process, free the retired node explicitly
+    while (manager.pendingCount(*participant))
+        manager.collect(*participant);
+    ASSERT_EQ(Node::Alive, 0);
+    manager.unregisterThread(*participant);
+}
+
+TEST(EpochManager, LockFreeStack)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr auto Iterations = 20000;
+
+    {
+        Core::EpochManager manager;
+        std::atomic<Node *> head {};
+        std::atomic<long> sum {};
+        std::vector<std::thread> threads;
+
+        for (auto t = 0; t != ThreadCount; ++t) {
+            threads.emplace_back([&, t] {
+                auto &participant = manager.registerThread();
+                for (auto i = 0; i != Iterations; ++i) {
+                    Core::EpochGuard guard(participant);
+                    if ((i + t) % 2) {
+                        const auto node = MakeNode(i);
+                        node->next = head.load(std::memory_order_relaxed);
+                        while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+                        sum += i;
+                    } else {
+                        auto node = head.load(std::memory_order_acquire);
+                        // Reading 'node->next' is safe because popped nodes are retired, not freed
+                        while (node && !head.compare_exchange_weak(node, node->next, std::memory_order_acquire, std::memory_order_acquire));
+                        if (node) {
+                            sum -= node->value;
+                            guard.retire(node);
+                        }
+                    }
+                }
+                manager.unregisterThread(participant);
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+        for (auto node = head.load(); node;) {
+            const auto next = node->next;
+            sum -= node->value;
+            node->~Node();
+            Core::DefaultStaticAllocator::Deallocate(node, sizeof(Node), alignof(Node));
+            node = next;
+        }
+        ASSERT_EQ(sum, 0);
+    }
+    ASSERT_EQ(Node::Alive, 0);
+}
\ No newline at end of file
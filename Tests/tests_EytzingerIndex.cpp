@@ -0,0 +1,91 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Eytzinger index unit tests
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/EytzingerIndex.hpp>
+#include <Kube/Core/SortedVector.hpp>
+
+using namespace kF;
+
+TEST(EytzingerIndex, Basics)
+{
+    Core::EytzingerIndex<int> index;
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.lowerBound(42), 0);
+    ASSERT_EQ(index.find(42), 0);
+
+    Core::SortedVector<int> sorted { 1, 3, 3, 5, 7 };
+    index.build(sorted);
+    ASSERT_EQ(index.size(), 5);
+    ASSERT_EQ(index.lowerBound(0), 0);
+    ASSERT_EQ(index.lowerBound(3), 1);
+    ASSERT_EQ(index.lowerBound(4), 3);
+    ASSERT_EQ(index.lowerBound(7), 4);
+    ASSERT_EQ(index.lowerBound(8), 5);
+    ASSERT_EQ(index.find(3), 1);
+    ASSERT_EQ(index.find(4), 5);
+    ASSERT_TRUE(index.contains(7));
+    ASSERT_FALSE(index.contains(8));
+
+    auto moved = std::move(index);
+    ASSERT_EQ(moved.find(5), 3);
+    moved.release();
+    ASSERT_TRUE(moved.empty());
+}
+
+TEST(EytzingerIndex, EveryShape)
+{
+    // Check every tree shape from empty up to several full levels
+    for (auto size = 0; size != 300; ++size) {
+        Core::SortedVector<int> sorted;
+        for (auto i = 0; i != size; ++i)
+            sorted.push(i * 2);
+        const Core::EytzingerIndex<int> index(sorted);
+        for (auto value = -1; value <= size * 2; ++value) {
+            const auto expected = static_cast<std::uint32_t>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+            ASSERT_EQ(index.lowerBound(value), expected);
+            ASSERT_EQ(index.find(value), value >= 0 && !(value % 2) && value < size * 2 ? expected : sorted.size());
+        }
+    }
+}
+
+TEST(EytzingerIndex, RandomDuplicates)
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(0, 5000);
+    Core::SortedVector<int> sorted;
+
+    for (auto i = 0; i != 20000; ++i)
+        sorted.push(distribution(engine));
+    const Core::EytzingerIndex<int> index(sorted);
+    for (auto i = 0; i != 20000; ++i) {
+        const auto value = distribution(engine);
+        const auto it = std::lower_bound(sorted.begin(), sorted.end(), value);
+        const auto expected = static_cast<std::uint32_t>(it - sorted.begin());
+        ASSERT_EQ(index.lowerBound(value), expected);
+        ASSERT_EQ(index.find(value), it != sorted.end() && *it == value ? expected : sorted.size());
+    }
+}
+
+TEST(EytzingerIndex, CustomCompare)
+{
+    Core::SortedVector<std::string, Core::DefaultStaticAllocator, std::greater<std::string>> sorted {
+        "alpha", "bravo", "charlie", "delta", "echo", "foxtrot"
+    };
+    const Core::EytzingerIndex<std::string, std::greater<std::string>> index(sorted.begin(), sorted.end());
+
+    ASSERT_EQ(index.find("foxtrot"), 0);
+    ASSERT_EQ(index.find("alpha"), 5);
+    ASSERT_EQ(index.find("golf"), 6);
+    ASSERT_EQ(index.lowerBound("d"), 3);
+    ASSERT_EQ(index.lowerBound("a"), 6);
+    ASSERT_EQ(index.lowerBound("z"), 0);
+}
\ No newline at end of file
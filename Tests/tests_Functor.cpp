@@ -3,6 +3,9 @@
  * @ Description: Trivial functor unit tests
  */
 
+#include <array>
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include <Kube/Core/Functor.hpp>
@@ -106,4 +109,86 @@ TEST(Functor, VariableArguments)
     ASSERT_EQ((Core::Functor<int(int, int)>([](int x) { return x; })(1, 2)), 1);
     ASSERT_EQ((Core::Functor<int(int, int)>([](int, int y) { return y; })(1, 2)), 2);
     ASSERT_EQ((Core::Functor<int(int, int)>([](int x, int y) { return x + y; })(1, 2)), 3);
-}
\ No newline at end of file
+}
+
+struct CountingAllocator
+{
+    static inline std::size_t Allocations = 0;
+
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { ++Allocations; return Core::DefaultStaticAllocator::Allocate(bytes, alignment); }
+
+    static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { --Allocations; Core::DefaultStaticAllocator::Deallocate(data, bytes, alignment); }
+};
+
+struct LifeCounter
+{
+    static inline int Alive = 0;
+
+    LifeCounter(void) noexcept { ++Alive; }
+    LifeCounter(LifeCounter &&) noexcept { ++Alive; }
+    LifeCounter(const LifeCounter &) = delete;
+    ~LifeCounter(void) noexcept { --Alive; }
+};
+
+TEST(Functor, InlineMoveOnlyFunctor)
+{
+    using InlineFunctor = Core::Functor<int(int), CountingAllocator>;
+
+    {
+        InlineFunctor func([y = std::make_unique<int>(2), counter = LifeCounter()](const int x) {
+            return x * *y;
+        });
+        ASSERT_EQ(CountingAllocator::Allocations, 0);
+        ASSERT_EQ(LifeCounter::Alive, 1);
+        ASSERT_EQ(func(4), 8);
+        auto func2(std::move(func));
+        ASSERT_FALSE(func);
+        ASSERT_TRUE(func2);
+        ASSERT_EQ(LifeCounter::Alive, 1);
+        ASSERT_EQ(func2(8), 16);
+        InlineFunctor func3([counter = LifeCounter()](const int x) { return x; });
+        ASSERT_EQ(LifeCounter::Alive, 2);
+        func3 = std::move(func2);
+        ASSERT_EQ(LifeCounter::Alive, 1);
+        ASSERT_EQ(func3(4), 8);
+        func3.release();
+        ASSERT_FALSE(func3);
+        ASSERT_EQ(LifeCounter::Alive, 0);
+        func3 = [counter = LifeCounter()](const int x) { return x; };
+        ASSERT_EQ(LifeCounter::Alive, 1);
+    }
+    ASSERT_EQ(LifeCounter::Alive, 0);
+    ASSERT_EQ(CountingAllocator::Allocations, 0);
+}
+
+TEST(Functor, DesiredSize)
+{
+    using SmallFunctor = Core::Functor<int(void), CountingAllocator>;
+    using LargeFunctor = Core::Functor<int(void), CountingAllocator, Core::CacheLineSize>;
+
+    std::array<int, 8> values { 1, 2, 3, 4, 5, 6, 7, 8 };
+    auto sum = [values, counter = LifeCounter()] {
+        int res = 0;
+        for (const auto value : values)
+            res += value;
+        return res;
+    };
+
+    {
+        SmallFunctor small(std::move(sum));
+        ASSERT_EQ(CountingAllocator::Allocations, 1);
+        LargeFunctor large([values, counter = LifeCounter()] { return values[7]; });
+        ASSERT_EQ(CountingAllocator::Allocations, 1);
+        ASSERT_EQ(small(), 36);
+        ASSERT_EQ(large(), 8);
+        auto small2(std::move(small));
+        auto large2(std::move(large));
+        ASSERT_EQ(CountingAllocator::Allocations, 1);
+        ASSERT_EQ(small2(), 36);
+        ASSERT_EQ(large2(), 8);
+    }
+    ASSERT_EQ(CountingAllocator::Allocations, 0);
+    ASSERT_EQ(LifeCounter::Alive, 1);
+}
@@ -0,0 +1,85 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Intrusive pointer tests
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/IntrusivePtr.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct CountingAllocator
+    {
+        static inline std::size_t Allocations = 0;
+
+        [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+            { ++Allocations; return Core::DefaultStaticAllocator::Allocate(bytes, alignment); }
+
+        static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+            { --Allocations; Core::DefaultStaticAllocator::Deallocate(data, bytes, alignment); }
+    };
+
+    template<bool IsAtomic>
+    struct Node : public Core::IntrusiveReferenceCount<IsAtomic>
+    {
+        std::string name {};
+        Core::IntrusivePtr<Node, CountingAllocator> next {};
+
+        Node(std::string &&name_) noexcept : name(std::move(name_)) {}
+    };
+}
+
+template<bool IsAtomic>
+static void TestIntrusive(void)
+{
+    using Ptr = Core::IntrusivePtr<Node<IsAtomic>, CountingAllocator>;
+
+    {
+        auto first = Ptr::Make("first");
+        ASSERT_TRUE(first);
+        ASSERT_EQ(first.referenceCount(), 1);
+        ASSERT_EQ(CountingAllocator::Allocations, 1);
+
+        // A new reference can be created from the raw pointer
+        Ptr other(first.get());
+        ASSERT_EQ(other, first);
+        ASSERT_EQ(first.referenceCount(), 2);
+
+        auto copy = first;
+        ASSERT_EQ(first.referenceCount(), 3);
+        copy = copy;
+        ASSERT_EQ(first.referenceCount(), 3);
+        other.release();
+        copy.release();
+        ASSERT_FALSE(copy);
+        ASSERT_EQ(first.referenceCount(), 1);
+
+        // Copying an instance does not copy its count
+        first->next = Ptr::Make("second");
+        Node<IsAtomic> value(*first->next);
+        ASSERT_EQ(value.referenceCount(), 0);
+        ASSERT_EQ(first->next.referenceCount(), 1);
+        ASSERT_EQ(CountingAllocator::Allocations, 2);
+
+        auto moved = std::move(first);
+        ASSERT_FALSE(first);
+        ASSERT_EQ(moved->name, "first");
+        ASSERT_EQ(moved->next->name, "second");
+    }
+    ASSERT_EQ(CountingAllocator::Allocations, 0);
+}
+
+TEST(IntrusivePtr, Atomic)
+{
+    TestIntrusive<true>();
+}
+
+TEST(IntrusivePtr, Local)
+{
+    TestIntrusive<false>();
+}
\ No newline at end of file
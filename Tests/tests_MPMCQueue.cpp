@@ -4,6 +4,8 @@
  */
 
 #include <thread>
+#include <vector>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -32,6 +34,50 @@ TEST(MPMCQueue, SinglePushPop)
     }
 }
 
+TEST(MPMCQueue, RangePushPop)
+{
+    constexpr auto test = [](auto &queue, const std::size_t size) {
+        const char ref = static_cast<char>(size % static_cast<std::size_t>(INT8_MAX));
+        std::vector<char> tmp(size);
+        for (auto &c : tmp)
+            c = ref;
+        ASSERT_TRUE(queue.tryPushRange(tmp.begin(), tmp.end()));
+        for (auto &c : tmp)
+            c = 0;
+        ASSERT_TRUE(queue.tryPopRange(tmp.begin(), tmp.end()));
+        for (const auto c : tmp)
+            ASSERT_EQ(c, ref);
+    };
+
+    constexpr std::size_t maxQueueSize = KUBE_DEBUG_BUILD ? 64 : 4096;
+
+    for (auto queueSize = 2ul; queueSize < maxQueueSize; queueSize *= 2) {
+        std::vector<char> tmp(queueSize + 1);
+        Core::MPMCQueue<char> queue(queueSize);
+        ASSERT_FALSE(queue.tryPushRange(tmp.data(), tmp.data() + queueSize + 1));
+        ASSERT_FALSE(queue.tryPopRange(tmp.data(), tmp.data() + 1));
+        for (auto size = 1ul; size <= queueSize; ++size)
+            test(queue, size);
+        for (auto size = queueSize; size > 0; --size)
+            test(queue, size);
+    }
+
+    Core::MPMCQueue<std::string> queue(maxQueueSize);
+    std::vector<std::string> tmp(maxQueueSize * 2, LongStr);
+    ASSERT_EQ(queue.pushRange(tmp.begin(), tmp.end()), maxQueueSize);
+    ASSERT_FALSE(queue.push(ShortStr));
+    ASSERT_EQ(queue.size(), maxQueueSize);
+    // Sources are left alive, pushed ones in their moved-from state
+    for (auto i = maxQueueSize; i != tmp.size(); ++i)
+        ASSERT_EQ(tmp[i], LongStr);
+    for (auto &str : tmp)
+        str.clear();
+    ASSERT_EQ(queue.popRange(tmp.begin(), tmp.end()), maxQueueSize);
+    ASSERT_EQ(queue.size(), 0);
+    for (auto i = 0ul; i != maxQueueSize; ++i)
+        ASSERT_EQ(tmp[i], LongStr);
+}
+
 TEST(MPMCQueue, IntensiveThreading)
 {
     constexpr auto ThreadCount = KUBE_DEBUG_BUILD ? 2 : 4;
@@ -75,4 +121,118 @@ TEST(MPMCQueue, IntensiveThreading)
         if (popThds[i].joinable())
             popThds[i].join();
     }
+}
+
+TEST(MPMCQueue, IntensiveThreadingRange)
+{
+    constexpr auto ThreadCount = KUBE_DEBUG_BUILD ? 2 : 4;
+    constexpr auto Range = KUBE_DEBUG_BUILD ? 8 : 64;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 64 : 4096;
+    constexpr std::size_t QueueSize = KUBE_DEBUG_BUILD ? 64 : 4096;
+
+    static_assert(Counter == (Counter / Range) * Range);
+
+    static std::atomic<bool> running { true };
+    static std::atomic<std::size_t> pushingThds { 0 };
+    static std::atomic<std::size_t> popCount { 0 };
+
+    std::vector<std::thread> pushThds(ThreadCount);
+    std::vector<std::thread> popThds(ThreadCount);
+
+    Core::MPMCQueue<int> queue(QueueSize);
+
+    for (auto i = 0; i < ThreadCount; ++i)
+        pushThds[i] = std::thread([&queue] {
+            ++pushingThds;
+            int cache[Range];
+            for (int i = 0; i < Range; ++i)
+                cache[i] = i;
+            for (std::size_t i = 0; i < Counter / ThreadCount;)
+                i += queue.pushRange(std::begin(cache), std::begin(cache) + std::min<std::size_t>(Range, Counter / ThreadCount - i));
+            --pushingThds;
+        });
+    for (auto i = 0; i < ThreadCount; ++i)
+        popThds[i] = std::thread([&queue] {
+            int cache[Range];
+            while (running)
+                popCount += queue.popRange(std::begin(cache), std::end(cache));
+        });
+    while (pushingThds)
+        std::this_thread::yield();
+    for (auto i = 0; i < ThreadCount; ++i) {
+        if (pushThds[i].joinable())
+            pushThds[i].join();
+    }
+    while (popCount != Counter)
+        std::this_thread::yield();
+    running = false;
+    for (auto i = 0; i < ThreadCount; ++i) {
+        if (popThds[i].joinable())
+            popThds[i].join();
+    }
+}
+
+template<Core::MPMCQueueLayout Layout>
+static void TestLayout(void)
+{
+    constexpr auto ThreadCount = KUBE_DEBUG_BUILD ? 2 : 4;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 4096ul : 65536ul;
+
+    // FIFO order must be preserved by the cell mapping
+    for (auto queueSize = 2ul; queueSize <= 256ul; queueSize *= 2) {
+        Core::MPMCQueue<std::size_t, Core::DefaultStaticAllocator, Layout> queue(queueSize);
+        std::vector<std::size_t> tmp(queueSize / 2);
+        std::size_t value;
+        for (auto i = 0ul; i < queueSize * 3; ++i) {
+            ASSERT_TRUE(queue.push(i));
+            ASSERT_TRUE(queue.pop(value));
+            ASSERT_EQ(value, i);
+        }
+        for (auto i = 0ul; i < queueSize; ++i)
+            ASSERT_TRUE(queue.push(i));
+        ASSERT_FALSE(queue.push(queueSize));
+        ASSERT_TRUE(queue.tryPopRange(tmp.begin(), tmp.end()));
+        for (auto i = 0ul; i < tmp.size(); ++i)
+            ASSERT_EQ(tmp[i], i);
+        ASSERT_TRUE(queue.tryPushRange(tmp.begin(), tmp.end()));
+        for (auto i = 0ul; i < queueSize; ++i) {
+            ASSERT_TRUE(queue.pop(value));
+            ASSERT_EQ(value, (i + queueSize / 2) % queueSize);
+        }
+    }
+
+    // Every pushed value must be popped exactly once
+    Core::MPMCQueue<std::size_t, Core::DefaultStaticAllocator, Layout> queue(64);
+    std::atomic<std::size_t> popCount { 0 };
+    std::atomic<std::size_t> popSum { 0 };
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < ThreadCount; ++i) {
+        threads.emplace_back([&queue] {
+            for (auto i = 0ul; i < Counter / ThreadCount;)
+                i += queue.push(i);
+        });
+        threads.emplace_back([&queue, &popCount, &popSum] {
+            std::size_t value;
+            while (popCount < Counter) {
+                if (queue.pop(value)) {
+                    popSum += value;
+                    ++popCount;
+                }
+            }
+        });
+    }
+    for (auto &thd : threads)
+        thd.join();
+    ASSERT_EQ(popCount, Counter);
+    ASSERT_EQ(popSum, ThreadCount * ((Counter / ThreadCount) * (Counter / ThreadCount - 1) / 2));
+}
+
+TEST(MPMCQueue, PaddedLayout)
+{
+    TestLayout<Core::MPMCQueueLayout::Padded>();
+}
+
+TEST(MPMCQueue, RemappedLayout)
+{
+    TestLayout<Core::MPMCQueueLayout::Remapped>();
 }
\ No newline at end of file
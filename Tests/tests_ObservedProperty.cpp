@@ -0,0 +1,121 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Observed property unit tests
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/ObservedProperty.hpp>
+
+using namespace kF;
+
+TEST(ObservedProperty, Basics)
+{
+    Core::ObservedProperty<int> property(1);
+    auto count = 0;
+    auto last = 0;
+
+    auto slot = property.dispatcher().add([&count, &last](const int value) { ++count; last = value; });
+    property = 1;
+    ASSERT_EQ(count, 0);
+    property = 2;
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(last, 2);
+    ASSERT_EQ(property.get(), 2);
+}
+
+TEST(ObservedProperty, Batch)
+{
+    Core::ObservedProperty<int> x(0), y(0), z(0);
+    auto count = 0;
+    auto sum = 0;
+
+    auto slotX = x.dispatcher().add([&](const int) { ++count; sum = x + y + z; });
+    auto slotY = y.dispatcher().add([&](const int) { ++count; sum = x + y + z; });
+    auto slotZ = z.dispatcher().add([&](const int) { ++count; sum = x + y + z; });
+    {
+        Core::ObservedPropertyBatch batch;
+        for (auto i = 1; i <= 50; ++i) {
+            x = i;
+            y = i * 2;
+            {
+                Core::ObservedPropertyBatch nested;
+                z = i * 3;
+            }
+        }
+        ASSERT_EQ(count, 0);
+    }
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(sum, 300);
+    x = 0;
+    ASSERT_EQ(count, 4);
+    ASSERT_EQ(sum, 250);
+}
+
+TEST(ObservedProperty, BatchLifetime)
+{
+    auto count = 0;
+    auto last = 0;
+    Core::ObservedProperty<int> moved(0);
+    auto slot = moved.dispatcher().add([&count, &last](const int value) { ++count; last = value; });
+    Core::DispatcherSlot temporarySlot;
+    {
+        Core::ObservedPropertyBatch batch;
+        {
+            Core::ObservedProperty<int> destroyed(0);
+            auto destroyedSlot = destroyed.dispatcher().add([&count](const int) { ++count; });
+            destroyed = 42;
+        }
+        auto temporary = std::make_unique<Core::ObservedProperty<int>>(0);
+        temporarySlot = temporary->dispatcher().add([&count, &last](const int value) { ++count; last = value; });
+        *temporary = 24;
+        moved = std::move(*temporary);
+        temporary.reset();
+    }
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(last, 24);
+}
+
+TEST(ObservedProperty, BatchRevertedValue)
+{
+    Core::ObservedProperty<int> property(1);
+    auto count = 0;
+    auto last = 0;
+
+    auto slot = property.dispatcher().add([&count, &last](const int value) { ++count; last = value; });
+    {
+        Core::ObservedPropertyBatch batch;
+        property = 2;
+        property = 1;
+    }
+    // The property is dispatched once even if its final value didn't change
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(last, 1);
+}
+
+TEST(ObservedProperty, BatchManyProperties)
+{
+    constexpr auto Count = 1000;
+    auto dispatched = 0;
+    Core::Vector<Core::ObservedProperty<int>> properties;
+    Core::Vector<Core::DispatcherSlot> slots;
+
+    properties.reserve(Count);
+    for (auto i = 0; i != Count; ++i) {
+        properties.push(0);
+        slots.push(properties.back().dispatcher().add([&dispatched](const int) { ++dispatched; }));
+    }
+    {
+        Core::ObservedPropertyBatch batch;
+        for (auto &property : properties)
+            property = 1;
+        // Destroy every other dirty property and move the others, entries are updated in place
+        for (auto i = 0; i != Count; i += 2)
+            properties[static_cast<std::uint32_t>(i)].~ObservedProperty();
+        for (auto i = 0; i != Count; i += 2)
+            new (&properties[static_cast<std::uint32_t>(i)]) Core::ObservedProperty<int>(std::move(properties[static_cast<std::uint32_t>(i + 1)]));
+    }
+    ASSERT_EQ(dispatched, Count / 2);
+}
\ No newline at end of file
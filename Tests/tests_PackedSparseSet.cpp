@@ -0,0 +1,125 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Packed sparse set unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/PackedSparseSet.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Countable
+    {
+        static inline int Counter = 0;
+
+        int value {};
+
+        Countable(const int v) noexcept : value(v) { ++Counter; }
+        Countable(Countable &&other) noexcept : value(other.value) { ++Counter; }
+        Countable &operator=(Countable &&other) noexcept = default;
+        ~Countable(void) noexcept { --Counter; }
+    };
+}
+
+TEST(PackedSparseSet, Basics)
+{
+    constexpr auto PageSize = 64;
+
+    Countable::Counter = 0;
+    {
+        Core::PackedSparseSet<Countable, PageSize> set;
+
+        ASSERT_TRUE(set.empty());
+        ASSERT_FALSE(set.contains(0));
+        ASSERT_FALSE(set.contains(1000));
+        ASSERT_EQ(set.find(1000), nullptr);
+
+        for (auto i = 0; i < 10; ++i)
+            ASSERT_EQ(set.add(i * 100, i).value, i);
+        ASSERT_EQ(set.size(), 10);
+        ASSERT_EQ(Countable::Counter, 10);
+        for (auto i = 0; i < 10; ++i) {
+            ASSERT_TRUE(set.contains(i * 100));
+            ASSERT_FALSE(set.contains(i * 100 + 1));
+            ASSERT_EQ(set.at(i * 100).value, i);
+        }
+
+        // Swap and pop
+        set.remove(0);
+        ASSERT_EQ(Countable::Counter, 9);
+        ASSERT_FALSE(set.contains(0));
+        ASSERT_EQ(set.values()[0].value, 9);
+        ASSERT_EQ(set.indexes()[0], 900);
+        ASSERT_EQ(set.at(900).value, 9);
+
+        ASSERT_EQ(set.extract(500).value, 5);
+        ASSERT_EQ(Countable::Counter, 8);
+        ASSERT_EQ(set.size(), 8);
+
+        auto sum = 0;
+        for (const auto &countable : set)
+            sum += countable.value;
+        ASSERT_EQ(sum, 45 - 5);
+        for (auto i = 0u; i < set.size(); ++i)
+            ASSERT_EQ(set.at(set.indexes()[i]).value, set.values()[i].value);
+
+        set.clear();
+        ASSERT_TRUE(set.empty());
+        ASSERT_EQ(Countable::Counter, 0);
+        ASSERT_FALSE(set.contains(900));
+        set.add(900, 42);
+        ASSERT_EQ(set.at(900).value, 42);
+    }
+    ASSERT_EQ(Countable::Counter, 0);
+}
+
+TEST(PackedSparseSet, Churn)
+{
+    constexpr auto Count = 4096;
+
+    Core::PackedSparseSet<int, 128> set;
+
+    for (auto i = 0; i < Count; ++i)
+        set.add(i * 3, i);
+    for (auto i = 0; i < Count; i += 2)
+        set.remove(i * 3);
+    ASSERT_EQ(set.size(), Count / 2);
+    for (auto i = 0; i < Count; ++i) {
+        ASSERT_EQ(set.contains(i * 3), i % 2 == 1);
+        if (i % 2) {
+            ASSERT_EQ(set.at(i * 3), i);
+        }
+    }
+    for (auto i = 0u; i < set.size(); ++i)
+        ASSERT_EQ(set.values()[i], set.indexes()[i] / 3);
+}
+
+TEST(PackedSparseSet, PageReclamation)
+{
+    constexpr auto PageSize = 16;
+
+    Core::PackedSparseSet<int, PageSize> set;
+
+    for (auto i = 0; i < 10 * PageSize; ++i) {
+        set.add(i, i);
+        if (i >= PageSize)
+            set.remove(i - PageSize);
+    }
+    ASSERT_EQ(set.size(), PageSize);
+    ASSERT_EQ(set.pageCount(), 1);
+    ASSERT_FALSE(set.contains(0));
+    set.shrinkToFit();
+    for (auto i = 9 * PageSize; i < 10 * PageSize; ++i)
+        ASSERT_EQ(set.at(i), i);
+    set.clear();
+    ASSERT_EQ(set.pageCount(), 0);
+    set.add(3, 3);
+    ASSERT_EQ(set.pageCount(), 1);
+    set.remove(3);
+    ASSERT_EQ(set.pageCount(), 0);
+    set.shrinkToFit();
+    ASSERT_FALSE(set.contains(3));
+}
@@ -0,0 +1,116 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the parallel algorithms
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/Parallel.hpp>
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+constexpr auto Count = KUBE_DEBUG_BUILD ? 100000ul : 1000000ul;
+
+TEST(Parallel, For)
+{
+    Core::Scheduler scheduler(2);
+    Core::Vector<std::size_t> vector(Count, 1ul);
+
+    Core::ParallelFor(scheduler, vector.toRange(), [](std::size_t &value) { value *= 2ul; });
+    for (const auto value : vector)
+        ASSERT_EQ(value, 2ul);
+    Core::ParallelFor(vector.toRange(), [](std::size_t &value) { ++value; }, 1ul);
+    for (const auto value : vector)
+        ASSERT_EQ(value, 3ul);
+}
+
+TEST(Parallel, Reduce)
+{
+    Core::Scheduler scheduler(2);
+    Core::Vector<std::size_t> vector(Count);
+
+    for (auto i = 0ul; i < Count; ++i)
+        vector[i] = i;
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange(), 0ul, std::plus<> {}), Count * (Count - 1) / 2);
+    ASSERT_EQ(Core::ParallelReduce(vector.toRange(), 42ul, std::plus<> {}, 3ul), Count * (Count - 1) / 2 + 42ul);
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange().subrange(0ul, 10ul), 1ul, std::plus<> {}), 46ul);
+}
+
+TEST(Parallel, ReduceCombine)
+{
+    Core::Scheduler scheduler(2);
+    Core::Vector<std::size_t> vector(Count);
+    std::size_t expected = 0ul;
+
+    for (auto i = 0ul; i < Count; ++i) {
+        vector[i] = i % 100ul;
+        expected += vector[i] * vector[i];
+    }
+    const auto sumOfSquares = [](const std::size_t acc, const std::size_t x) { return acc + x * x; };
+    // Parallel path
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange(), 0ul, sumOfSquares, std::plus<> {}), expected);
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange(), 0ul, sumOfSquares, std::plus<> {}, 7ul), expected);
+    ASSERT_EQ(Core::ParallelReduce(vector.toRange(), 0ul, sumOfSquares, std::plus<> {}, 1000ul), expected);
+    // Sequential path
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange().subrange(0ul, 10ul), 0ul, sumOfSquares, std::plus<> {}), 285ul);
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange().subrange(0ul, 10ul), 0ul, sumOfSquares, std::plus<> {}, 3ul), 285ul);
+    ASSERT_EQ(Core::ParallelReduce(scheduler, vector.toRange().subrange(0ul, 0ul), 0ul, sumOfSquares, std::plus<> {}), 0ul);
+}
+
+TEST(Parallel, Transform)
+{
+    Core::Scheduler scheduler(2);
+    Core::Vector<std::size_t> input(Count);
+    Core::Vector<std::string> output(Count);
+
+    for (auto i = 0ul; i < Count; ++i)
+        input[i] = i;
+    Core::ParallelTransform(scheduler, input.toRange(), output.begin(), [](const std::size_t value) { return std::to_string(value); });
+    for (auto i = 0ul; i < Count; ++i)
+        ASSERT_EQ(output[i], std::to_string(i));
+}
+
+TEST(Parallel, Sort)
+{
+    std::mt19937_64 generator(42);
+    Core::Scheduler scheduler(3);
+
+    for (const auto size : { 0ul, 1ul, 1000ul, 12345ul, Count }) {
+        for (const auto grainSize : { 0ul, 1ul, 100ul }) {
+            Core::Vector<std::size_t> vector(size);
+            for (auto &value : vector)
+                value = generator() % 1000ul;
+            Core::ParallelSort(scheduler, vector.toRange(), std::less<> {}, grainSize);
+            ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end()));
+        }
+    }
+    Core::Vector<std::string> strings(Count / 10ul);
+    for (auto &str : strings)
+        str = "Parallel sort string " + std::to_string(generator());
+    auto copy = strings;
+    std::sort(copy.begin(), copy.end(), std::greater<> {});
+    Core::ParallelSort(scheduler, strings.toRange(), std::greater<> {}, 64ul);
+    ASSERT_EQ(strings, copy);
+    std::shuffle(strings.begin(), strings.end(), generator);
+    Core::ParallelSort(strings.toRange(), std::greater<> {}, 64ul);
+    ASSERT_EQ(strings, copy);
+}
+
+TEST(Parallel, Nested)
+{
+    Core::Scheduler scheduler(2);
+    Core::Vector<std::size_t> outer(64ul, 0ul);
+    Core::Vector<std::size_t> inner(4096ul, 1ul);
+
+    Core::ParallelFor(scheduler, outer.toRange(), [&scheduler, &inner](std::size_t &value) {
+        value = Core::ParallelReduce(scheduler, inner.toRange(), 0ul, std::plus<> {}, 256ul);
+    }, 1ul);
+    for (const auto value : outer)
+        ASSERT_EQ(value, 4096ul);
+}
\ No newline at end of file
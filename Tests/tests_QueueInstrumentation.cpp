@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the queue instrumentation
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/QueueInstrumentation.hpp>
+#include <Kube/Core/SPSCQueue.hpp>
+
+using namespace kF;
+
+using Instrumentation = Core::QueueInstrumentation<Core::DefaultStaticAllocator, true>;
+
+TEST(QueueInstrumentation, LatencyBuckets)
+{
+    using Statistics = Core::QueueStatistics;
+
+    for (auto i = 0ul; i != Statistics::LatencyBucketCount; ++i) {
+        const auto lowerBound = Statistics::LatencyBucketLowerBound(i);
+        ASSERT_EQ(Statistics::LatencyBucketIndex(lowerBound), i);
+        if (lowerBound) {
+            ASSERT_EQ(Statistics::LatencyBucketIndex(lowerBound - 1), i - 1);
+        }
+    }
+    ASSERT_EQ(Statistics::LatencyBucketIndex(~static_cast<std::uint64_t>(0)), Statistics::LatencyBucketCount - 1);
+    // Relative error of a bucket is bounded by its sub-bucket resolution
+    ASSERT_EQ(Statistics::LatencyBucketLowerBound(Statistics::LatencyBucketIndex(1000)), 896);
+    ASSERT_EQ(Statistics::LatencyBucketLowerBound(Statistics::LatencyBucketIndex(1023)), 896);
+    ASSERT_EQ(Statistics::LatencyBucketLowerBound(Statistics::LatencyBucketIndex(1024)), 1024);
+}
+
+TEST(QueueInstrumentation, Percentile)
+{
+    Core::QueueStatistics statistics;
+
+    ASSERT_EQ(statistics.latencyPercentile(0.5), 0);
+    statistics.latencyBuckets[Core::QueueStatistics::LatencyBucketIndex(100)] = 90;
+    statistics.latencyBuckets[Core::QueueStatistics::LatencyBucketIndex(10000)] = 10;
+    statistics.latencySamples = 100;
+    ASSERT_EQ(statistics.latencyPercentile(0.0), 96);
+    ASSERT_EQ(statistics.latencyPercentile(0.5), 96);
+    ASSERT_EQ(statistics.latencyPercentile(0.95), 8192);
+    ASSERT_EQ(statistics.latencyPercentile(1.0), 8192);
+}
+
+TEST(QueueInstrumentation, Hooks)
+{
+    constexpr std::size_t CellCount = Instrumentation::SampleRate * 4;
+    Instrumentation instrumentation(CellCount);
+
+    instrumentation.onPushFailure();
+    instrumentation.onPushFailure();
+    // Single cells, only cell 0 is sampled
+    instrumentation.onPush(0, 1, [] { return 1ul; });
+    instrumentation.onPush(1, 1, [] { return 2ul; });
+    instrumentation.onPop(0, 1);
+    instrumentation.onPop(1, 1);
+    auto statistics = instrumentation.snapshot();
+    ASSERT_EQ(statistics.pushFailures, 2);
+    ASSERT_EQ(statistics.highWaterMark, 2);
+    ASSERT_EQ(statistics.latencySamples, 1);
+    // Ranges wrapping around the end sample cells 'SampleRate * 3' and 0
+    instrumentation.onPush(CellCount - Instrumentation::SampleRate - 1, Instrumentation::SampleRate + 2, [] { return 10ul; });
+    instrumentation.onPop(CellCount - Instrumentation::SampleRate - 1, Instrumentation::SampleRate + 2);
+    statistics = instrumentation.snapshot();
+    ASSERT_EQ(statistics.highWaterMark, 10);
+    ASSERT_EQ(statistics.latencySamples, 3);
+    instrumentation.reset();
+    statistics = instrumentation.snapshot();
+    ASSERT_EQ(statistics.pushFailures, 0);
+    ASSERT_EQ(statistics.highWaterMark, 0);
+    ASSERT_EQ(statistics.latencySamples, 0);
+}
+
+TEST(QueueInstrumentation, Disabled)
+{
+    using DisabledInstrumentation = Core::QueueInstrumentation<Core::DefaultStaticAllocator, false>;
+
+    ASSERT_TRUE(std::is_empty_v<DisabledInstrumentation>);
+    Core::SPSCQueue<int, Core::DefaultStaticAllocator, false> queue(4);
+    for (auto i = 0; i < 5; ++i)
+        static_cast<void>(queue.push(i));
+    ASSERT_EQ(queue.statistics().pushFailures, 0);
+    ASSERT_EQ(queue.statistics().highWaterMark, 0);
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of instrumented queues
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SPSCQueue.hpp>
+#include <Kube/Core/MPSCQueue.hpp>
+#include <Kube/Core/MPMCQueue.hpp>
+#include <Kube/Core/SPMCQueue.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Element
+    {
+        int value {};
+    };
+
+    template<typename Queue>
+    void TestStatistics(Queue &queue, const std::size_t capacity)
+    {
+        const auto sampledCount = [&queue] {
+            const auto statistics = queue.statistics();
+            std::size_t count = 0;
+            for (const auto bucket : statistics.latencyBuckets)
+                count += bucket;
+            EXPECT_EQ(count, statistics.latencySamples);
+            return statistics.latencySamples;
+        };
+
+        auto statistics = queue.statistics();
+        ASSERT_EQ(statistics.pushFailures, 0);
+        ASSERT_EQ(statistics.highWaterMark, 0);
+        ASSERT_EQ(sampledCount(), 0);
+
+        // Single push / pop, cell 0 is sampled
+        for (auto i = 0; i != static_cast<int>(capacity); ++i)
+            ASSERT_TRUE(queue.push(Element { i }));
+        ASSERT_FALSE(queue.push(Element {}));
+        statistics = queue.statistics();
+        ASSERT_EQ(statistics.pushFailures, 1);
+        ASSERT_EQ(statistics.highWaterMark, capacity);
+        for (auto i = 0; i != static_cast<int>(capacity); ++i) {
+            Element element;
+            ASSERT_TRUE(queue.pop(element));
+            ASSERT_EQ(element.value, i);
+        }
+        ASSERT_EQ(sampledCount(), 1);
+
+        // Range push / pop wrapping over cell 0, the partial push is a failure
+        std::vector<Element> elements(capacity + 2);
+        ASSERT_EQ(queue.pushRange(elements.begin(), elements.end()), capacity);
+        statistics = queue.statistics();
+        ASSERT_EQ(statistics.pushFailures, 2);
+        ASSERT_EQ(statistics.highWaterMark, capacity);
+        ASSERT_EQ(queue.popRange(elements.begin(), elements.end()), capacity);
+        ASSERT_EQ(sampledCount(), 2);
+
+        // A half filled queue doesn't raise the high-water mark
+        queue.resetStatistics();
+        ASSERT_EQ(queue.pushRange(elements.begin(), elements.begin() + static_cast<std::ptrdiff_t>(capacity / 2)), capacity / 2);
+        statistics = queue.statistics();
+        ASSERT_EQ(statistics.pushFailures, 0);
+        ASSERT_EQ(statistics.highWaterMark, capacity / 2);
+        ASSERT_EQ(queue.popRange(elements.begin(), elements.end()), capacity / 2);
+    }
+}
+
+TEST(QueueInstrumentationEnabled, SPSCQueue)
+{
+    constexpr std::size_t Capacity = 8;
+    Core::SPSCQueue<Element, Core::DefaultStaticAllocator, true> queue(Capacity);
+
+    TestStatistics(queue, Capacity);
+}
+
+TEST(QueueInstrumentationEnabled, MPSCQueue)
+{
+    constexpr std::size_t Capacity = 8;
+    Core::MPSCQueue<Element, Core::DefaultStaticAllocator, true> queue(Capacity);
+
+    TestStatistics(queue, Capacity);
+}
+
+TEST(QueueInstrumentationEnabled, MPMCQueue)
+{
+    constexpr std::size_t Capacity = 8;
+    Core::MPMCQueue<Element, Core::DefaultStaticAllocator, Core::MPMCQueueLayout::Packed, true> queue(Capacity);
+
+    TestStatistics(queue, Capacity);
+}
+
+TEST(QueueInstrumentationEnabled, SPMCQueue)
+{
+    constexpr std::size_t Capacity = 8;
+    Core::SPMCQueue<Element, Core::DefaultStaticAllocator, true> queue(Capacity);
+
+    TestStatistics(queue, Capacity);
+}
\ No newline at end of file
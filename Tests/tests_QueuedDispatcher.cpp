@@ -0,0 +1,118 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Queued dispatcher unit tests
+ */
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/QueuedDispatcher.hpp>
+
+using namespace kF;
+
+TEST(QueuedDispatcher, Basics)
+{
+    Core::QueuedDispatcher<void(const std::string &, int)> dispatcher(4);
+    std::string received;
+    auto sum = 0;
+
+    auto handle = dispatcher.add([&received, &sum](const std::string &str, const int value) {
+        received += str;
+        sum += value;
+    });
+    ASSERT_EQ(dispatcher.count(), 1);
+    {
+        std::string str("hello");
+        ASSERT_TRUE(dispatcher.post(str, 1));
+    }
+    ASSERT_TRUE(dispatcher.post(" ", 2));
+    ASSERT_TRUE(dispatcher.post("world", 3));
+    ASSERT_EQ(dispatcher.pendingCount(), 3);
+    ASSERT_TRUE(received.empty());
+    ASSERT_EQ(dispatcher.process(2), 2);
+    ASSERT_EQ(received, "hello ");
+    ASSERT_EQ(dispatcher.process(), 1);
+    ASSERT_EQ(received, "hello world");
+    ASSERT_EQ(sum, 6);
+    ASSERT_EQ(dispatcher.process(), 0);
+    dispatcher.dispatch("!", 4);
+    ASSERT_EQ(received, "hello world!");
+    ASSERT_EQ(sum, 10);
+}
+
+TEST(QueuedDispatcher, Full)
+{
+    Core::QueuedDispatcher<void(int)> dispatcher(4);
+    auto sum = 0;
+
+    auto handle = dispatcher.add([&sum](const int value) { sum += value; });
+    for (auto i = 0; i < 4; ++i)
+        ASSERT_TRUE(dispatcher.post(i));
+    ASSERT_FALSE(dispatcher.post(42));
+    ASSERT_EQ(dispatcher.process(), 4);
+    ASSERT_EQ(sum, 6);
+    // Wrapped batches
+    for (auto i = 0; i < 3; ++i)
+        ASSERT_TRUE(dispatcher.post(1));
+    ASSERT_EQ(dispatcher.process(), 3);
+    ASSERT_EQ(sum, 9);
+}
+
+TEST(QueuedDispatcher, DiscardPending)
+{
+    const auto counter = std::make_shared<int>(0);
+    auto sum = 0;
+    {
+        // Arguments that are not default constructible
+        Core::QueuedDispatcher<void(std::reference_wrapper<int>, std::shared_ptr<int>)> dispatcher(4);
+
+        auto handle = dispatcher.add([](int &value, const std::shared_ptr<int> &ptr) { value += ++*ptr; });
+        for (auto i = 0; i < 3; ++i)
+            ASSERT_TRUE(dispatcher.post(sum, counter));
+        ASSERT_EQ(dispatcher.process(1), 1);
+        ASSERT_EQ(sum, 1);
+        ASSERT_EQ(counter.use_count(), 3);
+    }
+    // Pending events are destroyed without being dispatched
+    ASSERT_EQ(counter.use_count(), 1);
+    ASSERT_EQ(*counter, 1);
+}
+
+TEST(QueuedDispatcher, IntensiveThreading)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = 10000;
+
+    Core::QueuedDispatcher<void(std::size_t)> dispatcher(512);
+    const auto ownerId = std::this_thread::get_id();
+    std::size_t sum = 0;
+    auto handle = dispatcher.add([&sum, ownerId](const std::size_t value) {
+        ASSERT_EQ(std::this_thread::get_id(), ownerId);
+        sum += value;
+    });
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back([&dispatcher] {
+            for (auto i = 1ul; i <= Counter; ++i) {
+                while (!dispatcher.post(i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    std::size_t processed = 0;
+    while (processed != ThreadCount * Counter) {
+        const auto count = dispatcher.process(64);
+        if (!count)
+            std::this_thread::yield();
+        processed += count;
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(sum, ThreadCount * (Counter * (Counter + 1) / 2));
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the record queues
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/SPSCRecordQueue.hpp>
+#include <Kube/Core/MPSCRecordQueue.hpp>
+
+using namespace kF;
+
+constexpr auto LongStr = "123456789123456789";
+
+namespace
+{
+    struct Small
+    {
+        std::uint8_t value;
+    };
+
+    struct alignas(32) Large
+    {
+        std::size_t values[8];
+    };
+
+    using Records = std::tuple<Small, Large, std::string>;
+
+    /** @brief Visitor that records the order of visited types */
+    struct OrderVisitor
+    {
+        std::vector<std::string> &out;
+
+        void operator()(Small &record) { out.push_back("small" + std::to_string(record.value)); }
+        void operator()(Large &record) { out.push_back("large" + std::to_string(record.values[7])); }
+        void operator()(std::string &record) { out.push_back(std::move(record)); }
+    };
+}
+
+template<typename Queue>
+static void TestEmplaceConsume(void)
+{
+    Queue queue(512);
+    std::vector<std::string> out;
+
+    ASSERT_EQ(Queue::BlockSize, alignof(Large));
+    ASSERT_FALSE(queue.pop(OrderVisitor { out }));
+    for (auto round = 0u; round < 32; ++round) {
+        ASSERT_TRUE(queue.template emplace<Small>(static_cast<std::uint8_t>(round)));
+        ASSERT_TRUE(queue.template emplace<std::string>(LongStr + std::to_string(round)));
+        ASSERT_TRUE(queue.template emplace<Large>(Large { { 0, 0, 0, 0, 0, 0, 0, round } }));
+        ASSERT_TRUE(queue.pop(OrderVisitor { out }));
+        ASSERT_EQ(queue.consume(OrderVisitor { out }), 2);
+        ASSERT_EQ(out.size(), 3);
+        ASSERT_EQ(out[0], "small" + std::to_string(round));
+        ASSERT_EQ(out[1], LongStr + std::to_string(round));
+        ASSERT_EQ(out[2], "large" + std::to_string(round));
+        out.clear();
+    }
+    // Records left inside the queue are destroyed with it
+    for (auto i = 0; i < 4; ++i)
+        ASSERT_TRUE(queue.template emplace<std::string>(LongStr));
+}
+
+template<typename Queue>
+static void TestFull(void)
+{
+    Queue queue(Queue::BlockSize * 8);
+    std::size_t count = 0;
+    const auto visitor = [&count](auto &) { ++count; };
+
+    // Large records use 3 blocks and small records 2 blocks, out of 8 usable blocks
+    ASSERT_TRUE(queue.template emplace<Large>());
+    ASSERT_TRUE(queue.template emplace<Large>());
+    ASSERT_FALSE(queue.template emplace<Large>());
+    ASSERT_TRUE(queue.pop(visitor));
+    // Fits exactly before the end of the ring
+    ASSERT_TRUE(queue.template emplace<Large>());
+    ASSERT_FALSE(queue.template emplace<Large>());
+    ASSERT_TRUE(queue.template emplace<Small>());
+    ASSERT_FALSE(queue.template emplace<Small>());
+    ASSERT_EQ(queue.consume(visitor), 3);
+    ASSERT_TRUE(queue.template emplace<Large>());
+    ASSERT_TRUE(queue.template emplace<Large>());
+    // A single block is left before the end of the ring and the head is not far enough to wrap
+    ASSERT_FALSE(queue.template emplace<Small>());
+    ASSERT_EQ(queue.consume(visitor), 2);
+    // Padding record skips the last block
+    ASSERT_TRUE(queue.template emplace<Small>());
+    ASSERT_EQ(queue.consume(visitor), 1);
+    ASSERT_EQ(count, 7);
+}
+
+template<typename Queue, std::size_t ProducerCount>
+static void TestIntensiveThreading(void)
+{
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 4096 : 65536;
+
+    std::vector<std::thread> pushThds(ProducerCount);
+    Queue queue(4096);
+
+    for (auto &thd : pushThds)
+        thd = std::thread([&queue] {
+            for (auto i = 0u; i < Counter / ProducerCount;) {
+                if (i % 3)
+                    i += queue.template emplace<Small>(static_cast<std::uint8_t>(1));
+                else
+                    i += queue.template emplace<std::string>(LongStr);
+            }
+        });
+    std::size_t sum = 0;
+    std::size_t count = 0;
+    while (count != Counter) {
+        count += queue.consume([&sum]<typename Type>(Type &record) {
+            if constexpr (std::is_same_v<Type, Small>)
+                sum += record.value;
+            else if constexpr (std::is_same_v<Type, std::string>)
+                sum += record == LongStr;
+        });
+    }
+    for (auto &thd : pushThds)
+        thd.join();
+    ASSERT_EQ(sum, Counter);
+}
+
+TEST(RecordQueue, SPSCEmplaceConsume) { TestEmplaceConsume<Core::SPSCRecordQueue<Records>>(); }
+TEST(RecordQueue, MPSCEmplaceConsume) { TestEmplaceConsume<Core::MPSCRecordQueue<Records>>(); }
+
+TEST(RecordQueue, SPSCFull) { TestFull<Core::SPSCRecordQueue<Records>>(); }
+TEST(RecordQueue, MPSCFull) { TestFull<Core::MPSCRecordQueue<Records>>(); }
+
+TEST(RecordQueue, SPSCIntensiveThreading) { TestIntensiveThreading<Core::SPSCRecordQueue<Records>, 1>(); }
+TEST(RecordQueue, MPSCIntensiveThreading) { TestIntensiveThreading<Core::MPSCRecordQueue<Records>, 4>(); }
\ No newline at end of file
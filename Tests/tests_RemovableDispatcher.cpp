@@ -3,6 +3,10 @@
  * @ Description: Trivial functor unit tests
  */
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <Kube/Core/RemovableTrivialDispatcher.hpp>
@@ -127,3 +131,105 @@ TEST(RemovableDispatcher, Semantics)
     dispatcher2.dispatch([&i](int z) { ASSERT_EQ(z, 8); ++i; }, 4, 2);
     ASSERT_EQ(i, 2);
 }
+
+
+TEST(RemovableDispatcher, Churn)
+{
+    constexpr auto Count = 256;
+
+    Core::RemovableDispatcher<void(std::vector<int> &)> dispatcher;
+    std::vector<Core::DispatcherSlot> slots;
+
+    for (auto i = 0; i < Count; ++i) {
+        switch (i % 3) {
+        case 0:
+            slots.push_back(dispatcher.add([i](std::vector<int> &out) { out.push_back(i); }));
+            break;
+        case 1:
+            slots.push_back(dispatcher.add([i, ptr = std::make_unique<int>(i)](std::vector<int> &out) { out.push_back(*ptr); }));
+            break;
+        default:
+            slots.push_back(dispatcher.add([i, y = 0ull](std::vector<int> &out) { out.push_back(i + int(y)); }));
+            break;
+        }
+    }
+    ASSERT_EQ(dispatcher.count(), Count);
+
+    // Remove every even slot
+    for (auto i = 0; i < Count; i += 2)
+        slots[i] = {};
+    ASSERT_EQ(dispatcher.count(), Count / 2);
+
+    std::vector<int> out;
+    dispatcher.dispatch(out);
+    ASSERT_EQ(out.size(), Count / 2);
+    std::sort(out.begin(), out.end());
+    for (auto i = 0; i < Count / 2; ++i)
+        ASSERT_EQ(out[i], i * 2 + 1);
+
+    // Functors sharing the same invoke function are dispatched in a row
+    out.clear();
+    dispatcher.dispatch(out);
+    auto groupChanges = 0;
+    for (auto i = 1u; i < out.size(); ++i)
+        groupChanges += (out[i] % 3) != (out[i - 1] % 3);
+    ASSERT_EQ(groupChanges, 2);
+
+    // Refill removed slots
+    for (auto i = 0; i < Count; i += 2)
+        slots[i] = dispatcher.add([i](std::vector<int> &out) { out.push_back(i); });
+    ASSERT_EQ(dispatcher.count(), Count);
+    out.clear();
+    dispatcher.dispatch(out);
+    std::sort(out.begin(), out.end());
+    for (auto i = 0; i < Count; ++i)
+        ASSERT_EQ(out[i], i);
+
+    slots.clear();
+    ASSERT_EQ(dispatcher.count(), 0);
+}
+
+
+TEST(RemovableDispatcher, ModifyWhileDispatching)
+{
+    Core::RemovableDispatcher<void(std::vector<int> &)> dispatcher;
+    Core::DispatcherSlot s0, s1, s2, added;
+
+    // All slots share the same group, slot 0 is dispatched first and removes slot 1
+    s0 = dispatcher.add([&](std::vector<int> &out) {
+        out.push_back(0);
+        s1 = {};
+        if (!added)
+            added = dispatcher.add([&](std::vector<int> &out) { out.push_back(3); });
+    });
+    s1 = dispatcher.add([&](std::vector<int> &out) { out.push_back(1); });
+    s2 = dispatcher.add([&](std::vector<int> &out) {
+        out.push_back(2);
+        // A slot may remove itself
+        s2 = {};
+    });
+
+    std::vector<int> out;
+    dispatcher.dispatch(out);
+    ASSERT_EQ(out, (std::vector<int> { 0, 2 }));
+    ASSERT_EQ(dispatcher.count(), 2);
+
+    out.clear();
+    dispatcher.dispatch(out);
+    ASSERT_EQ(out, (std::vector<int> { 0, 3 }));
+
+    // A slot added then removed during the same dispatch is never called
+    out.clear();
+    Core::DispatcherSlot transient;
+    auto remover = dispatcher.add([&](std::vector<int> &) {
+        transient = dispatcher.add([](std::vector<int> &out) { out.push_back(4); });
+        transient = {};
+    });
+    dispatcher.dispatch(out);
+    dispatcher.dispatch(out);
+    ASSERT_EQ(std::count(out.begin(), out.end(), 4), 0);
+    remover = {};
+    s0 = {};
+    added = {};
+    ASSERT_EQ(dispatcher.count(), 0);
+}
\ No newline at end of file
@@ -68,6 +68,92 @@ TEST(SPSCQueue, RangePushPop)
     ASSERT_EQ(queue.popRange(tmp.begin(), tmp.end()), maxQueueSize);
 }
 
+TEST(SPSCQueue, ReserveCommitPeekRelease)
+{
+    Core::SPSCQueue<std::string> queue(4);
+
+    ASSERT_FALSE(queue.peek());
+    ASSERT_TRUE(queue.tryReserve(5, std::string()).empty());
+    auto reservation = queue.reserve(3);
+    ASSERT_EQ(reservation.size(), 3);
+    for (auto &cell : reservation)
+        new (&cell) std::string(LongStr);
+    queue.commit(reservation.size());
+    auto range = queue.peekRange();
+    ASSERT_EQ(range.size(), 3);
+    for (const auto &str : range)
+        ASSERT_EQ(str, LongStr);
+    queue.release(2);
+    // Only 2 cells are contiguous before the end of the ring
+    reservation = queue.reserve(4);
+    ASSERT_EQ(reservation.size(), 2);
+    for (auto &cell : reservation)
+        new (&cell) std::string(ShortStr);
+    queue.commit(reservation.size());
+    // Wrapped cells
+    reservation = queue.tryReserve(1, std::string());
+    ASSERT_EQ(reservation.size(), 1);
+    new (reservation.begin()) std::string(ShortStr);
+    queue.commit(reservation.size());
+    ASSERT_TRUE(queue.reserve(1).empty());
+    ASSERT_EQ(*queue.peek(), LongStr);
+    queue.release(1);
+    range = queue.peekRange(4);
+    ASSERT_EQ(range.size(), 2);
+    for (const auto &str : range)
+        ASSERT_EQ(str, ShortStr);
+    queue.release(range.size());
+    ASSERT_EQ(*queue.peek(), ShortStr);
+    queue.release(1);
+    ASSERT_FALSE(queue.peek());
+}
+
+TEST(SPSCQueue, TryReserveWrapBoundary)
+{
+    static constexpr auto Padding = -1;
+
+    Core::SPSCQueue<int> queue(8);
+    const auto pushPop = [&queue](const int count) {
+        for (auto i = 0; i < count; ++i)
+            ASSERT_TRUE(queue.push(i));
+        for (auto i = 0, tmp = 0; i < count; ++i)
+            ASSERT_TRUE(queue.pop(tmp));
+    };
+    const auto reserveCommit = [&queue](const int count) {
+        auto reservation = queue.tryReserve(static_cast<std::size_t>(count), Padding);
+        ASSERT_EQ(reservation.size(), count);
+        for (auto i = 0; auto &cell : reservation)
+            new (&cell) int(i++);
+        queue.commit(reservation.size());
+    };
+    const auto expectPop = [&queue](const int paddingCount, const int count) {
+        int tmp = 0;
+        for (auto i = 0; i < paddingCount; ++i) {
+            ASSERT_TRUE(queue.pop(tmp));
+            ASSERT_EQ(tmp, Padding);
+        }
+        for (auto i = 0; i < count; ++i) {
+            ASSERT_TRUE(queue.pop(tmp));
+            ASSERT_EQ(tmp, i);
+        }
+        ASSERT_FALSE(queue.pop(tmp));
+    };
+
+    // Only 3 cells remain before the end of the buffer, they are padded and the reservation wraps
+    pushPop(6);
+    reserveCommit(4);
+    expectPop(3, 4);
+    // The beginning of the buffer is too small, the padding is consumed before the reservation succeeds
+    pushPop(1);
+    ASSERT_TRUE(queue.tryReserve(6, Padding).empty());
+    expectPop(4, 0);
+    reserveCommit(6);
+    expectPop(0, 6);
+    // Reservations larger than the queue never pad
+    ASSERT_TRUE(queue.tryReserve(9, Padding).empty());
+    ASSERT_FALSE(queue.peek());
+}
+
 TEST(SPSCQueue, IntensiveThreading)
 {
     constexpr auto Counter = KUBE_DEBUG_BUILD ? 64 : 4096;
@@ -86,4 +172,30 @@ TEST(SPSCQueue, IntensiveThreading)
     }
     if (thd.joinable())
         thd.join();
+}
+
+TEST(SPSCQueue, IntensiveThreadingReserve)
+{
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 64 : 4096;
+    constexpr std::size_t queueSize = KUBE_DEBUG_BUILD ? 16 : 256;
+
+    Core::SPSCQueue<int> queue(queueSize);
+
+    std::thread thd([&queue] {
+        for (auto i = 0; i < Counter;) {
+            const auto reservation = queue.reserve(7);
+            for (auto &cell : reservation)
+                new (&cell) int(i++);
+            queue.commit(reservation.size());
+        }
+    });
+
+    for (auto i = 0; i < Counter;) {
+        const auto range = queue.peekRange(5);
+        for (const auto value : range)
+            ASSERT_EQ(value, i++);
+        queue.release(range.size());
+    }
+    if (thd.joinable())
+        thd.join();
 }
\ No newline at end of file
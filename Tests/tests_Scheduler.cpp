@@ -0,0 +1,74 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the scheduler
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/Scheduler.hpp>
+
+using namespace kF;
+
+TEST(Scheduler, Basics)
+{
+    constexpr auto Counter = 1024ul;
+
+    Core::Scheduler scheduler(2, 64);
+    std::atomic<std::size_t> count { 0 };
+
+    ASSERT_EQ(scheduler.workerCount(), 2);
+    ASSERT_FALSE(scheduler.isWorkerThread());
+    for (auto i = 0ul; i < Counter; ++i)
+        scheduler.schedule([&count] { ++count; });
+    scheduler.waitIdle();
+    ASSERT_EQ(count, Counter);
+}
+
+TEST(Scheduler, NestedTasks)
+{
+    constexpr auto ThreadCount = KUBE_DEBUG_BUILD ? 2 : 4;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 256ul : 4096ul;
+    constexpr auto SubCounter = 16ul;
+
+    Core::Scheduler scheduler(ThreadCount, 8);
+    std::atomic<std::size_t> count { 0 };
+
+    for (auto i = 0ul; i < Counter; ++i) {
+        // Nested tasks overflow worker queues into the injection queue
+        scheduler.schedule([&scheduler, &count] {
+            for (auto j = 0ul; j < SubCounter; ++j)
+                scheduler.schedule([&count] { ++count; });
+        });
+    }
+    scheduler.waitIdle();
+    ASSERT_EQ(count, Counter * SubCounter);
+}
+
+TEST(Scheduler, IdleWakeUp)
+{
+    Core::Scheduler scheduler(2);
+    std::atomic<std::size_t> count { 0 };
+
+    for (auto i = 0ul; i < 8; ++i) {
+        // Let workers park themselves
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        scheduler.schedule([&count] { ++count; });
+        while (count != i + 1)
+            std::this_thread::yield();
+    }
+    ASSERT_EQ(count, 8);
+}
+
+TEST(Scheduler, DestructorWaitsTasks)
+{
+    constexpr auto Counter = 256ul;
+
+    std::atomic<std::size_t> count { 0 };
+    {
+        Core::Scheduler scheduler(2);
+        for (auto i = 0ul; i < Counter; ++i)
+            scheduler.schedule([&count] { ++count; });
+    }
+    ASSERT_EQ(count, Counter);
+}
\ No newline at end of file
@@ -115,3 +115,25 @@ TEST(SharedPtr, String)
     ptr1.release();
     ASSERT_FALSE(ptr1);
 }
+
+
+TEST(SharedPtr, Local)
+{
+    using Ptr = Core::LocalSharedPtr<std::string>;
+
+    static_assert(std::is_same_v<Ptr::Count, std::uint32_t>);
+
+    auto ptr1 = Ptr::Make("hello");
+    TestValue(ptr1, std::string("hello"));
+    Ptr ptr2(ptr1);
+    ASSERT_EQ(ptr1.referenceCount(), 2);
+    {
+        Ptr ptr3;
+        ptr3 = ptr2;
+        ASSERT_EQ(ptr1.referenceCount(), 3);
+    }
+    ASSERT_EQ(ptr1.referenceCount(), 2);
+    ptr1.release();
+    ASSERT_EQ(ptr2.referenceCount(), 1);
+    TestValue(ptr2, std::string("hello"));
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the Shared Record Queue
+ */
+
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SharedRecordQueue.hpp>
+
+using namespace kF;
+
+TEST(SharedRecordQueue, PushPop)
+{
+    constexpr std::size_t ByteCapacity = 64;
+    alignas(Core::SharedSPSCQueue<Core::SharedRecordQueue::Block>::Header)
+        std::uint8_t region[Core::SharedRecordQueue::RequiredSize(ByteCapacity)];
+    Core::SharedRecordQueue queue(region, sizeof(region), true);
+    std::string_view received;
+    const auto receive = [&received](const std::byte * const data, const std::uint32_t size) {
+        received = std::string_view(reinterpret_cast<const char *>(data), size);
+    };
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.pop(receive));
+    for (auto round = 0; round < 16; ++round) {
+        const auto str = std::string(static_cast<std::size_t>(round % 13), static_cast<char>('a' + round));
+        ASSERT_TRUE(queue.push(str.data(), static_cast<std::uint32_t>(str.size())));
+        ASSERT_TRUE(queue.push("hello", 5));
+        ASSERT_TRUE(queue.pop(receive));
+        ASSERT_EQ(received, str);
+        ASSERT_TRUE(queue.pop(receive));
+        ASSERT_EQ(received, "hello");
+        ASSERT_TRUE(queue.empty());
+    }
+}
+
+TEST(SharedRecordQueue, Full)
+{
+    constexpr std::size_t ByteCapacity = 64;
+    alignas(Core::SharedSPSCQueue<Core::SharedRecordQueue::Block>::Header)
+        std::uint8_t region[Core::SharedRecordQueue::RequiredSize(ByteCapacity)];
+    Core::SharedRecordQueue queue(region, sizeof(region), true);
+    const char data[24] {};
+    std::size_t count = 0;
+
+    // Each record uses 4 blocks out of 8 usable
+    ASSERT_TRUE(queue.push(data, sizeof(data)));
+    ASSERT_TRUE(queue.push(data, sizeof(data)));
+    ASSERT_FALSE(queue.push(data, sizeof(data)));
+    ASSERT_TRUE(queue.pop([&count](const std::byte *, const std::uint32_t size) { count += size; }));
+    // The next record must wrap, but the head is not far enough yet
+    ASSERT_FALSE(queue.push(data, sizeof(data)));
+    ASSERT_TRUE(queue.pop([&count](const std::byte *, const std::uint32_t size) { count += size; }));
+    ASSERT_TRUE(queue.push(data, sizeof(data)));
+    ASSERT_TRUE(queue.pop([&count](const std::byte *, const std::uint32_t size) { count += size; }));
+    ASSERT_EQ(count, 3 * sizeof(data));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(SharedRecordQueue, IntensiveThreading)
+{
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 64u : 4096u;
+    constexpr std::size_t ByteCapacity = 256;
+    alignas(Core::SharedSPSCQueue<Core::SharedRecordQueue::Block>::Header)
+        std::uint8_t region[Core::SharedRecordQueue::RequiredSize(ByteCapacity)];
+    Core::SharedRecordQueue producer(region, sizeof(region), true);
+    Core::SharedRecordQueue consumer(region, sizeof(region), false);
+
+    std::thread thd([&producer] {
+        std::uint32_t record[16];
+        for (auto i = 0u; i < Counter;) {
+            const auto count = i % 16 + 1;
+            for (auto j = 0u; j < count; ++j)
+                record[j] = i;
+            i += producer.push(record, static_cast<std::uint32_t>(count * sizeof(std::uint32_t)));
+        }
+    });
+
+    for (auto i = 0u; i < Counter; ++i) {
+        bool ok = true;
+        while (!consumer.pop([i, &ok](const std::byte * const data, const std::uint32_t size) {
+            ok = size == (i % 16 + 1) * sizeof(std::uint32_t);
+            for (auto j = 0u; ok && j < size / sizeof(std::uint32_t); ++j) {
+                std::uint32_t value;
+                std::memcpy(&value, data + j * sizeof(std::uint32_t), sizeof(value));
+                ok = value == i;
+            }
+        }));
+        ASSERT_TRUE(ok);
+    }
+    if (thd.joinable())
+        thd.join();
+}
\ No newline at end of file
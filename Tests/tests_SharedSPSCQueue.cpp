@@ -0,0 +1,151 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the Shared SPSC Queue
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Platform.hpp>
+#include <Kube/Core/SharedMemory.hpp>
+#include <Kube/Core/SharedSPSCQueue.hpp>
+
+#if !KUBE_PLATFORM_WINDOWS
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+using namespace kF;
+
+namespace
+{
+    struct Message
+    {
+        int id;
+        double value;
+    };
+}
+
+TEST(SharedSPSCQueue, SinglePushPop)
+{
+    constexpr std::size_t Capacity = 8;
+    alignas(Core::SharedSPSCQueue<Message>::Header) std::uint8_t region[Core::SharedSPSCQueue<Message>::RequiredSize(Capacity)];
+    Core::SharedSPSCQueue<Message> producer(region, sizeof(region), true);
+    Core::SharedSPSCQueue<Message> consumer(region, sizeof(region), false);
+    Message message {};
+
+    ASSERT_FALSE(consumer.pop(message));
+    for (auto round = 0; round < 3; ++round) {
+        for (auto i = 0; i < static_cast<int>(Capacity); ++i)
+            ASSERT_TRUE(producer.push(Message { i, i * 0.5 }));
+        ASSERT_FALSE(producer.push(Message {}));
+        ASSERT_EQ(consumer.size(), Capacity);
+        for (auto i = 0; i < static_cast<int>(Capacity); ++i) {
+            ASSERT_TRUE(consumer.pop(message));
+            ASSERT_EQ(message.id, i);
+            ASSERT_EQ(message.value, i * 0.5);
+        }
+        ASSERT_FALSE(consumer.pop(message));
+    }
+}
+
+TEST(SharedSPSCQueue, RangePushPop)
+{
+    constexpr std::size_t Capacity = 16;
+    alignas(Core::SharedSPSCQueue<int>::Header) std::uint8_t region[Core::SharedSPSCQueue<int>::RequiredSize(Capacity)];
+    Core::SharedSPSCQueue<int> queue(region, sizeof(region), true);
+    std::vector<int> values(Capacity + 1);
+
+    for (auto i = 0u; i < values.size(); ++i)
+        values[i] = static_cast<int>(i);
+    ASSERT_FALSE(queue.tryPushRange(values.data(), values.data() + values.size()));
+    for (auto round = 0; round < 5; ++round) {
+        ASSERT_EQ(queue.pushRange(values.data(), values.data() + 11), 11);
+        std::vector<int> out(11);
+        ASSERT_TRUE(queue.tryPopRange(out.data(), out.data() + out.size()));
+        for (auto i = 0u; i < out.size(); ++i)
+            ASSERT_EQ(out[i], values[i]);
+    }
+    ASSERT_EQ(queue.pushRange(values.data(), values.data() + values.size()), Capacity);
+    std::vector<int> out(values.size());
+    ASSERT_EQ(queue.popRange(out.data(), out.data() + out.size()), Capacity);
+}
+
+TEST(SharedSPSCQueue, ReserveCommitPeekRelease)
+{
+    constexpr std::size_t Capacity = 4;
+    alignas(Core::SharedSPSCQueue<int>::Header) std::uint8_t region[Core::SharedSPSCQueue<int>::RequiredSize(Capacity)];
+    Core::SharedSPSCQueue<int> queue(region, sizeof(region), true);
+
+    auto reservation = queue.reserve(3);
+    ASSERT_EQ(reservation.size(), 3);
+    for (auto &cell : reservation)
+        cell = 1;
+    queue.commit(reservation.size());
+    queue.release(queue.peekRange(2).size());
+    reservation = queue.reserve(4);
+    ASSERT_EQ(reservation.size(), 2);
+    queue.commit(reservation.size());
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(*queue.peek(), 1);
+}
+
+TEST(SharedSPSCQueue, IntensiveThreading)
+{
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 64 : 4096;
+    constexpr std::size_t Capacity = 64;
+    alignas(Core::SharedSPSCQueue<int>::Header) std::uint8_t region[Core::SharedSPSCQueue<int>::RequiredSize(Capacity)];
+    Core::SharedSPSCQueue<int> producer(region, sizeof(region), true);
+    Core::SharedSPSCQueue<int> consumer(region, sizeof(region), false);
+
+    std::thread thd([&producer] {
+        for (auto i = 0; i < Counter; i += producer.push(i));
+    });
+
+    for (auto i = 0; i < Counter; ++i) {
+        int tmp = 0;
+        while (!consumer.pop(tmp));
+        ASSERT_EQ(tmp, i);
+    }
+    if (thd.joinable())
+        thd.join();
+}
+
+#if !KUBE_PLATFORM_WINDOWS
+TEST(SharedSPSCQueue, CrossProcess)
+{
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 64 : 4096;
+    constexpr std::size_t Capacity = 64;
+    const auto name = "/kube_tests_SharedSPSCQueue_" + std::to_string(getpid());
+
+    auto memory = Core::SharedMemory::Create(name.c_str(), Core::SharedSPSCQueue<Message>::RequiredSize(Capacity));
+    ASSERT_TRUE(memory);
+    ASSERT_TRUE(memory.isOwner());
+    ASSERT_FALSE(Core::SharedMemory::Create(name.c_str(), memory.size()));
+    Core::SharedSPSCQueue<Message> consumer(memory.data(), memory.size(), true);
+
+    const auto pid = fork();
+    ASSERT_NE(pid, -1);
+    if (!pid) {
+        // The child maps the region at a different address
+        auto childMemory = Core::SharedMemory::Open(name.c_str());
+        if (!childMemory || childMemory.isOwner())
+            _exit(1);
+        Core::SharedSPSCQueue<Message> producer(childMemory.data(), childMemory.size(), false);
+        for (auto i = 0; i < Counter; i += producer.push(Message { i, i * 2.0 }));
+        _exit(0);
+    }
+    for (auto i = 0; i < Counter; ++i) {
+        Message message {};
+        while (!consumer.pop(message));
+        ASSERT_EQ(message.id, i);
+        ASSERT_EQ(message.value, i * 2.0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+}
+#endif
\ No newline at end of file
@@ -103,6 +103,33 @@ TEST(Vector, Insert) \
     ASSERT_EQ(vector[i++], 42u); \
 } \
  \
+TEST(Vector, BatchInsert) \
+{ \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> DECLARE_VECTOR(vector, AllocatorMode); \
+    const std::size_t unsorted[] { 9u, 1u, 5u, 3u, 7u }; \
+    const std::size_t sorted[] { 0u, 4u, 4u, 8u, 10u }; \
+    const std::size_t after[] { 11u, 12u }; \
+ \
+    vector.insert(std::begin(unsorted), std::end(unsorted)); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(vector.size(), 5); \
+    vector.insert(std::begin(unsorted), std::end(unsorted)); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(vector.size(), 10); \
+    vector.insertSorted(std::begin(sorted), std::end(sorted)); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(vector.size(), 15); \
+    vector.insertSorted(std::begin(after), std::end(after)); \
+    vector.insertSorted(std::begin(after), std::begin(after)); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(vector.size(), 17); \
+    const std::size_t expected[] { 0u, 1u, 1u, 3u, 3u, 4u, 4u, 5u, 5u, 7u, 7u, 8u, 9u, 9u, 10u, 11u, 12u }; \
+    for (auto i = 0u; i < vector.size(); ++i) \
+        ASSERT_EQ(vector[i], expected[i]); \
+    vector.push(6u); \
+    ASSERT_EQ(vector[9], 6u); \
+} \
+ \
 TEST(Vector, Resize) \
 { \
     Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> DECLARE_VECTOR(vector, AllocatorMode); \
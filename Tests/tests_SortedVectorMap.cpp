@@ -0,0 +1,103 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sorted vector map unit tests
+ */
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SortedVectorMap.hpp>
+
+using namespace kF;
+
+TEST(SortedVectorMap, Basics)
+{
+    Core::SortedVectorMap<int, std::string> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(1), nullptr);
+    ASSERT_EQ(map.insertOrAssign(3, "three"), "three");
+    ASSERT_EQ(map.insertOrAssign(1, "one"), "one");
+    ASSERT_EQ(map.insertOrAssign(2, "two"), "two");
+    ASSERT_EQ(map.size(), 3);
+    for (auto i = 0u; i != map.size(); ++i)
+        ASSERT_EQ(map.keyAt(i), int(i + 1));
+    ASSERT_EQ(*map.find(2), "two");
+    map.insertOrAssign(2, "deux");
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(*map.find(2), "deux");
+    ASSERT_EQ(map.valueAt(1), "deux");
+    ASSERT_EQ(map.lowerBound(0), 0);
+    ASSERT_EQ(map.lowerBound(3), 2);
+    ASSERT_EQ(map.lowerBound(4), 3);
+    ASSERT_TRUE(map.erase(1));
+    ASSERT_FALSE(map.erase(1));
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_EQ(map.findIndex(3), 1);
+    ASSERT_EQ(map.valueAt(0), "deux");
+    map.clear();
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(SortedVectorMap, Build)
+{
+    const std::vector<std::pair<int, int>> pairs { { 5, 0 }, { 2, 1 }, { 5, 2 }, { 9, 3 }, { 2, 4 }, { 1, 5 } };
+    Core::SortedVectorMap<int, int> map(pairs.begin(), pairs.end());
+
+    ASSERT_EQ(map.size(), 4);
+    ASSERT_EQ(map.keys(), (Core::Vector<int> { 1, 2, 5, 9 }));
+    // The last occurence of a key is kept
+    ASSERT_EQ(map.values(), (Core::Vector<int> { 5, 4, 2, 3 }));
+
+    map = { { 3, 1 }, { 2, 2 } };
+    ASSERT_EQ(map.keys(), (Core::Vector<int> { 2, 3 }));
+    ASSERT_EQ(map.values(), (Core::Vector<int> { 2, 1 }));
+}
+
+TEST(SortedVectorMap, CustomCompare)
+{
+    Core::SortedVectorMap<int, int, Core::DefaultStaticAllocator, std::greater<int>> map { { 1, 1 }, { 3, 3 }, { 2, 2 } };
+
+    ASSERT_EQ(map.keys(), (Core::Vector<int> { 3, 2, 1 }));
+    ASSERT_EQ(map.lowerBound(4), 0);
+    ASSERT_EQ(map.lowerBound(2), 1);
+    ASSERT_EQ(map.lowerBound(0), 3);
+    ASSERT_EQ(*map.find(1), 1);
+}
+
+TEST(SortedVectorMap, Random)
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(0, 2000);
+    Core::SortedVectorMap<int, int> map;
+    std::map<int, int> reference;
+
+    for (auto i = 0; i != 10000; ++i) {
+        const auto key = distribution(engine);
+        if (i % 4 == 3) {
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1);
+        } else {
+            map.insertOrAssign(key, i);
+            reference.insert_or_assign(key, i);
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    auto index = 0u;
+    for (const auto &[key, value] : reference) {
+        ASSERT_EQ(map.keyAt(index), key);
+        ASSERT_EQ(map.valueAt(index), value);
+        ++index;
+    }
+    for (auto key = -1; key <= 2001; ++key) {
+        const auto it = reference.find(key);
+        const auto value = map.find(key);
+        ASSERT_EQ(value != nullptr, it != reference.end());
+        if (value) {
+            ASSERT_EQ(*value, it->second);
+        }
+    }
+}
\ No newline at end of file
@@ -16,6 +16,7 @@ struct Countable
     int value {};
 
     Countable(const int v) noexcept : value(v) { ++Counter; }
+    Countable(Countable &&other) noexcept : value(other.value) { ++Counter; }
     ~Countable(void) noexcept { --Counter; }
 };
 
@@ -48,4 +49,40 @@ TEST(SparseSet, Basics)
 
     // Consequence is non-destructed object (=> memory leak)
     ASSERT_EQ(Countable::Counter, 1);
-}
\ No newline at end of file
+}
+
+TEST(SparseSet, PageReclamation)
+{
+    constexpr auto PageSize = 16;
+
+    Countable::Counter = 0;
+    Core::SparseSet<Countable, PageSize> sparseSet;
+
+    // Sliding index range
+    for (auto i = 0; i < 10 * PageSize; ++i) {
+        sparseSet.add(i, i);
+        if (i >= PageSize)
+            sparseSet.remove(i - PageSize);
+    }
+    ASSERT_EQ(Countable::Counter, PageSize);
+    ASSERT_EQ(sparseSet.pageCount(), 1);
+    ASSERT_FALSE(sparseSet.pageExists(0));
+    ASSERT_TRUE(sparseSet.pageExists(9 * PageSize));
+    ASSERT_EQ(sparseSet.pageOccupancy(9 * PageSize), PageSize);
+
+    sparseSet.add(PageSize, 42);
+    ASSERT_EQ(sparseSet.pageCount(), 2);
+    ASSERT_EQ(sparseSet.extract(9 * PageSize).value, 9 * PageSize);
+    ASSERT_EQ(sparseSet.pageOccupancy(9 * PageSize), PageSize - 1);
+    for (auto i = 9 * PageSize + 1; i < 10 * PageSize; ++i)
+        sparseSet.remove(i);
+    ASSERT_FALSE(sparseSet.pageExists(9 * PageSize));
+    ASSERT_EQ(sparseSet.pageCount(), 1);
+
+    sparseSet.shrinkToFit();
+    ASSERT_EQ(sparseSet.at(PageSize).value, 42);
+    sparseSet.remove(PageSize);
+    ASSERT_EQ(sparseSet.pageCount(), 0);
+    sparseSet.shrinkToFit();
+    ASSERT_EQ(Countable::Counter, 0);
+}
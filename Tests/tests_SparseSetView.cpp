@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sparse set view unit tests
+ */
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SparseSetView.hpp>
+
+using namespace kF;
+
+TEST(SparseSetView, Basics)
+{
+    constexpr std::uint32_t Count = 10000;
+
+    Core::PackedSparseSet<int, 256> a;
+    Core::PackedSparseSet<float, 128> b;
+    Core::PackedSparseSet<std::size_t, 512> c;
+
+    for (auto i = 0u; i < Count; ++i) {
+        a.add(i, int(i));
+        if (!(i % 2))
+            b.add(i, float(i));
+        if (!(i % 3))
+            c.add(i, std::size_t(i));
+    }
+    // Holes in the lead set must not be visited
+    c.remove(0);
+
+    const auto &constB = b;
+    Core::SparseSetView view(a, constB, c);
+    ASSERT_EQ(view.leadSet(), 2);
+    ASSERT_EQ(view.sizeHint(), c.size());
+
+    std::size_t visited = 0;
+    view.each([&visited](const std::uint32_t index, int &x, const float &y, std::size_t &z) {
+        ASSERT_EQ(index % 6, 0);
+        ASSERT_NE(index, 0);
+        ASSERT_EQ(x, int(index));
+        ASSERT_EQ(y, float(index));
+        ASSERT_EQ(z, index);
+        x = -x;
+        ++visited;
+    });
+    ASSERT_EQ(visited, (Count + 5) / 6 - 1);
+    for (auto i = 1u; i < Count; ++i)
+        ASSERT_EQ(a.at(i), (i % 6) ? int(i) : -int(i));
+
+    // Single set view
+    std::size_t sum = 0;
+    Core::SparseSetView(c).each([&sum](const std::uint32_t, const std::size_t value) { sum += value; });
+    ASSERT_EQ(sum, 3ul * ((Count - 1) / 3) * ((Count - 1) / 3 + 1) / 2);
+}
+
+TEST(SparseSetView, ParallelEach)
+{
+    constexpr std::uint32_t Count = 100000;
+
+    Core::Scheduler scheduler(2);
+    Core::PackedSparseSet<std::size_t, 1024> a;
+    Core::PackedSparseSet<std::size_t, 1024> b;
+
+    for (auto i = 0u; i < Count; ++i) {
+        a.add(i, 1ul);
+        if (i % 4)
+            b.add(i, std::size_t(i));
+    }
+
+    std::atomic<std::size_t> sum { 0 };
+    std::atomic<std::size_t> visited { 0 };
+    Core::SparseSetView(a, b).parallelEach(scheduler, [&sum, &visited](const std::uint32_t, std::size_t &x, const std::size_t y) {
+        x = 2;
+        sum += y;
+        ++visited;
+    }, 1024);
+    std::size_t expected = 0;
+    for (auto i = 0u; i < Count; ++i) {
+        if (i % 4)
+            expected += i;
+        ASSERT_EQ(a.at(i), (i % 4) ? 2ul : 1ul);
+    }
+    ASSERT_EQ(visited, Count - Count / 4);
+    ASSERT_EQ(sum, expected);
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the task graph
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/TaskGraph.hpp>
+
+using namespace kF;
+
+TEST(TaskGraph, Basics)
+{
+    Core::Scheduler scheduler(2);
+    Core::TaskGraph graph;
+    std::atomic<std::size_t> step { 0 };
+    std::size_t a = 0, b = 0, c = 0, d = 0;
+
+    // a -> (b, c) -> d
+    const auto nodeA = graph.add([&] { a = ++step; });
+    const auto nodeB = graph.add([&] { b = ++step; });
+    const auto nodeC = graph.add([&] { c = ++step; });
+    const auto nodeD = graph.add([&] { d = ++step; });
+    graph.precede(nodeA, nodeB);
+    graph.precede(nodeA, nodeC);
+    graph.precede(nodeB, nodeD);
+    graph.precede(nodeC, nodeD);
+    ASSERT_EQ(graph.nodeCount(), 4);
+    ASSERT_EQ(graph.node(nodeD).dependencyCount, 2);
+    for (auto i = 0u; i < 10u; ++i) {
+        step = 0;
+        graph.run(scheduler);
+        ASSERT_EQ(a, 1);
+        ASSERT_GT(b, a);
+        ASSERT_GT(c, a);
+        ASSERT_EQ(d, 4);
+    }
+    graph.clear();
+    ASSERT_EQ(graph.nodeCount(), 0);
+    graph.run(scheduler);
+}
+
+TEST(TaskGraph, Layers)
+{
+    constexpr auto LayerCount = KUBE_DEBUG_BUILD ? 16u : 64u;
+    constexpr auto LayerSize = 32u;
+    constexpr auto RunCount = KUBE_DEBUG_BUILD ? 8u : 64u;
+
+    Core::Scheduler scheduler(4);
+    Core::TaskGraph graph;
+    std::atomic<std::size_t> layers[LayerCount] {};
+    std::atomic<bool> error { false };
+
+    // Each node of a layer depends on every node of the previous one
+    for (auto layer = 0u; layer < LayerCount; ++layer) {
+        for (auto i = 0u; i < LayerSize; ++i) {
+            const auto node = graph.add([&layers, &error, layer] {
+                if (layer && layers[layer - 1].load() % LayerSize)
+                    error = true;
+                ++layers[layer];
+            });
+            if (layer) {
+                for (auto j = 0u; j < LayerSize; ++j)
+                    graph.precede((layer - 1) * LayerSize + j, node);
+            }
+        }
+    }
+    for (auto run = 1u; run <= RunCount; ++run) {
+        graph.run(scheduler);
+        for (auto &layer : layers)
+            ASSERT_EQ(layer.load(), run * LayerSize);
+    }
+    ASSERT_FALSE(error);
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the unbounded queues
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/UnboundedMPSCQueue.hpp>
+#include <Kube/Core/UnboundedMPMCQueue.hpp>
+
+using namespace kF;
+
+constexpr auto LongStr = "123456789123456789";
+
+template<typename Queue>
+static void TestSinglePushPop(void)
+{
+    constexpr std::size_t Count = 100;
+
+    Queue queue;
+    std::string str;
+
+    ASSERT_FALSE(queue.pop(str));
+    for (auto i = 0u; i < Count; ++i)
+        queue.push(LongStr + std::to_string(i));
+    for (auto i = 0u; i < Count; ++i) {
+        ASSERT_TRUE(queue.pop(str));
+        ASSERT_EQ(str, LongStr + std::to_string(i));
+    }
+    ASSERT_FALSE(queue.pop(str));
+    for (auto i = 0u; i < Count; ++i)
+        queue.push(LongStr);
+}
+
+/** @brief Allocator counting the segments allocated by a queue */
+struct CountingAllocator
+{
+    static inline std::atomic<std::size_t> Allocations { 0 };
+
+    [[nodiscard]] static inline void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { ++Allocations; return Core::DefaultStaticAllocator::Allocate(bytes, alignment); }
+
+    static inline void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { Core::DefaultStaticAllocator::Deallocate(data, bytes, alignment); }
+};
+
+template<typename Queue, std::size_t SegmentCapacity>
+static void TestSegmentRecycling(void)
+{
+    constexpr std::size_t Rounds = 64;
+
+    CountingAllocator::Allocations = 0;
+    {
+        Queue queue;
+        std::vector<int> values(SegmentCapacity * 3);
+        int value = 0;
+
+        ASSERT_EQ(CountingAllocator::Allocations, 1);
+        for (auto round = 0ul; round != Rounds; ++round) {
+            // Fill more than two segments, exhausted segments are retired then reused
+            for (auto i = 0; i != static_cast<int>(SegmentCapacity + 1); ++i)
+                queue.push(i);
+            for (auto i = 0; auto &v : values)
+                v = static_cast<int>(SegmentCapacity) + 1 + i++;
+            queue.pushRange(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(SegmentCapacity + 2));
+            for (auto i = 0; i != 3; ++i) {
+                ASSERT_TRUE(queue.pop(value));
+                ASSERT_EQ(value, i);
+            }
+            std::fill(values.begin(), values.end(), -1);
+            ASSERT_EQ(queue.popRange(values.begin(), values.end()), SegmentCapacity * 2);
+            for (auto i = 0; i != static_cast<int>(SegmentCapacity * 2); ++i)
+                ASSERT_EQ(values[static_cast<std::size_t>(i)], i + 3);
+            ASSERT_FALSE(queue.pop(value));
+            ASSERT_EQ(queue.popRange(values.begin(), values.end()), 0);
+        }
+        // Steady state only uses recycled segments
+        ASSERT_LE(CountingAllocator::Allocations, 4);
+    }
+}
+
+template<typename Queue, std::size_t ConsumerCount>
+static void TestIntensiveThreading(void)
+{
+    constexpr auto ThreadCount = KUBE_DEBUG_BUILD ? 2 : 4;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 4096 : 65536;
+
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> popCount { 0 };
+    std::atomic<std::size_t> popSum { 0 };
+    std::vector<std::thread> pushThds(ThreadCount);
+    std::vector<std::thread> popThds(ConsumerCount);
+
+    Queue queue;
+
+    for (auto i = 0; i < ThreadCount; ++i)
+        pushThds[i] = std::thread([&queue] {
+            constexpr auto Half = Counter / ThreadCount / 2;
+            for (auto i = 0; i < Half; ++i)
+                queue.push(i);
+            // Second half is pushed by batches
+            int batch[4];
+            for (auto i = Half; i < Counter / ThreadCount; i += 4) {
+                for (auto j = 0; j != 4; ++j)
+                    batch[j] = i + j;
+                queue.pushRange(std::begin(batch), std::end(batch));
+            }
+        });
+    for (auto &thd : popThds)
+        thd = std::thread([&queue, &running, &popCount, &popSum] {
+            while (running) {
+                int tmp = 0;
+                while (queue.pop(tmp)) {
+                    popSum += static_cast<std::size_t>(tmp);
+                    ++popCount;
+                }
+                int batch[3];
+                for (auto count = queue.popRange(std::begin(batch), std::end(batch)); count; count = queue.popRange(std::begin(batch), std::end(batch))) {
+                    for (auto i = 0ul; i != count; ++i)
+                        popSum += static_cast<std::size_t>(batch[i]);
+                    popCount += count;
+                }
+            }
+        });
+    for (auto &thd : pushThds)
+        thd.join();
+    while (popCount != Counter)
+        std::this_thread::yield();
+    running = false;
+    for (auto &thd : popThds)
+        thd.join();
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(popSum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+}
+
+TEST(UnboundedMPSCQueue, SinglePushPop)
+{
+    TestSinglePushPop<Core::UnboundedMPSCQueue<std::string, Core::DefaultStaticAllocator, 8>>();
+}
+
+TEST(UnboundedMPSCQueue, SegmentRecycling)
+{
+    TestSegmentRecycling<Core::UnboundedMPSCQueue<int, CountingAllocator, 4>, 4>();
+}
+
+TEST(UnboundedMPSCQueue, IntensiveThreading)
+{
+    TestIntensiveThreading<Core::UnboundedMPSCQueue<int, Core::DefaultStaticAllocator, 64>, 1>();
+}
+
+TEST(UnboundedMPMCQueue, SinglePushPop)
+{
+    TestSinglePushPop<Core::UnboundedMPMCQueue<std::string, Core::DefaultStaticAllocator, 8>>();
+}
+
+TEST(UnboundedMPMCQueue, SegmentRecycling)
+{
+    TestSegmentRecycling<Core::UnboundedMPMCQueue<int, CountingAllocator, 4>, 4>();
+}
+
+TEST(UnboundedMPMCQueue, IntensiveThreading)
+{
+    TestIntensiveThreading<Core::UnboundedMPMCQueue<int, Core::DefaultStaticAllocator, 64>, KUBE_DEBUG_BUILD ? 2 : 4>();
+}
\ No newline at end of file
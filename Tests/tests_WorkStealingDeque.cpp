@@ -0,0 +1,92 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the work stealing deque
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Debug.hpp>
+#include <Kube/Core/WorkStealingDeque.hpp>
+
+using namespace kF;
+
+TEST(WorkStealingDeque, SinglePushPop)
+{
+    constexpr std::size_t Capacity = 16;
+
+    Core::WorkStealingDeque<std::size_t> deque(Capacity);
+    std::size_t value;
+
+    ASSERT_EQ(deque.capacity(), Capacity);
+    ASSERT_FALSE(deque.pop(value));
+    ASSERT_FALSE(deque.steal(value));
+    for (auto i = 0ul; i < Capacity; ++i)
+        ASSERT_TRUE(deque.push(i));
+    ASSERT_FALSE(deque.push(Capacity));
+    ASSERT_EQ(deque.size(), Capacity);
+    // Owner pops in LIFO order
+    for (auto i = 0ul; i < Capacity / 2; ++i) {
+        ASSERT_TRUE(deque.pop(value));
+        ASSERT_EQ(value, Capacity - i - 1);
+    }
+    // Thieves steal in FIFO order
+    for (auto i = 0ul; i < Capacity / 2; ++i) {
+        ASSERT_TRUE(deque.steal(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(deque.pop(value));
+    ASSERT_FALSE(deque.steal(value));
+    ASSERT_EQ(deque.size(), 0);
+}
+
+TEST(WorkStealingDeque, IntensiveThreading)
+{
+    constexpr auto ThiefCount = KUBE_DEBUG_BUILD ? 2 : 4;
+    constexpr auto Counter = KUBE_DEBUG_BUILD ? 65536ul : 1048576ul;
+
+    Core::WorkStealingDeque<std::size_t> deque(1024);
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> count { 0 };
+    std::atomic<std::size_t> sum { 0 };
+    std::vector<std::thread> thieves(ThiefCount);
+
+    for (auto &thd : thieves) {
+        thd = std::thread([&deque, &running, &count, &sum] {
+            std::size_t value;
+            while (running) {
+                if (deque.steal(value)) {
+                    sum += value;
+                    ++count;
+                }
+            }
+        });
+    }
+    std::size_t value;
+    for (auto i = 0ul; i < Counter; ++i) {
+        while (!deque.push(i)) {
+            if (deque.pop(value)) {
+                sum += value;
+                ++count;
+            }
+        }
+        // Pop from time to time to race against thieves
+        if (!(i % 3) && deque.pop(value)) {
+            sum += value;
+            ++count;
+        }
+    }
+    while (deque.pop(value)) {
+        sum += value;
+        ++count;
+    }
+    while (count != Counter)
+        std::this_thread::yield();
+    running = false;
+    for (auto &thd : thieves)
+        thd.join();
+    ASSERT_EQ(count, Counter);
+    ASSERT_EQ(sum, Counter * (Counter - 1) / 2);
+}
\ No newline at end of file
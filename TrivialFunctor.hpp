@@ -90,6 +90,14 @@ public:
     /** @brief Check if the functor is prepared */
     [[nodiscard]] inline operator bool(void) const noexcept { return _invoke; }
 
+    /** @brief Get the opaque invoke function, functors sharing it run the same code */
+    [[nodiscard]] inline OpaqueInvoke invoker(void) const noexcept { return _invoke; }
+
+    /** @brief Invoke internal functor through 'invoke', which must be the invoke function of this functor
+     *  Dispatchers load the invoke function once for a whole group of functors sharing it */
+    inline Return invokeWith(const OpaqueInvoke invoke, Args ...args) const noexcept
+        { return invoke(const_cast<Cache &>(_cache), std::forward<Args>(args)...); }
+
 
     /** @brief Release cache (nothing to free) */
     inline void release(void) noexcept { _invoke = nullptr; }
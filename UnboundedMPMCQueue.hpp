@@ -0,0 +1,22 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded MPMC Queue
+ */
+
+#pragma once
+
+#include "UnboundedQueueDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief The unbounded MPMC queue is a lock-free queue that supports Multiple Producers and Multiple Consumers
+     * The queue grows by linking segments of 'SegmentCapacity' cells, thus push never fails
+     *
+     * @tparam Type to be inserted
+     * @tparam Allocator Static allocator used to allocate segments
+     * @tparam SegmentCapacity Number of cells of each segment
+     */
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::size_t SegmentCapacity = 1024>
+    using UnboundedMPMCQueue = Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, true>;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded MPSC Queue
+ */
+
+#pragma once
+
+#include "UnboundedQueueDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief The unbounded MPSC queue is a lock-free queue that supports Multiple Producers and a Single Consumer
+     * The queue grows by linking segments of 'SegmentCapacity' cells, thus push never fails
+     *
+     * @tparam Type to be inserted
+     * @tparam Allocator Static allocator used to allocate segments
+     * @tparam SegmentCapacity Number of cells of each segment
+     */
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::size_t SegmentCapacity = 1024>
+    using UnboundedMPSCQueue = Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, false>;
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded Queue Details
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+    class UnboundedQueueDetails;
+}
+
+/**
+ * @brief Implementation details of unbounded lock-free queues
+ * The queue is a linked list of fixed size segments, each segment being a ring of 'SegmentCapacity' cells.
+ * Producers claim a cell with a single fetch-add on the tail segment, consumers claim a cell with a CAS (or a store
+ * when there is a single consumer) on the head segment.
+ * Exhausted segments are recycled through a lock-free free list, the allocator is only used when the free list is empty.
+ * Each segment keeps a count of threads currently using it so that it is never recycled under their feet,
+ * range operations use the segment once per batch instead of once per element.
+ * @note Segments are only deallocated on destruction, memory usage follows the peak number of segments
+ *
+ * @tparam Type to be inserted
+ * @tparam Allocator Static allocator
+ * @tparam SegmentCapacity Number of cells of each segment
+ * @tparam MultipleConsumers If true, multiple threads may pop concurrently
+ */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+class alignas_double_cacheline kF::Core::Internal::UnboundedQueueDetails
+{
+public:
+    static_assert(SegmentCapacity >= 2, "UnboundedQueue: SegmentCapacity must be at least 2");
+
+    /** @brief Each cell represent the queued type and a ready flag */
+    struct Cell
+    {
+        std::atomic<bool> ready { false };
+        union {
+            Type data;
+        };
+
+        /** @brief Data is not initialized */
+        inline Cell(void) noexcept {}
+
+        /** @brief Data is not destroyed */
+        inline ~Cell(void) noexcept {}
+    };
+
+    /** @brief A segment of the queue */
+    struct alignas_cacheline Segment
+    {
+        alignas_cacheline std::atomic<std::size_t> tail { 0 }; // Tail accessed by producers
+        alignas_cacheline std::atomic<std::size_t> head { 0 }; // Head accessed by consumers
+        alignas_cacheline std::atomic<Segment *> next {}; // Next segment in the queue (or in the free list)
+        alignas_cacheline std::atomic<std::size_t> users { 0 }; // Number of threads using the segment & retired flag
+        alignas_cacheline Cell cells[SegmentCapacity];
+    };
+
+    /** @brief Flag marking a segment as retired inside its 'users' count */
+    static constexpr std::size_t RetiredFlag = 1ul << (sizeof(std::size_t) * 8 - 1);
+
+
+    /** @brief Destruct and release all memory (unsafe) */
+    ~UnboundedQueueDetails(void) noexcept;
+
+    /** @brief Default constructor initialize the queue with a single segment
+     *  @param preallocatedSegments Number of segments to store in the free list */
+    UnboundedQueueDetails(const std::size_t preallocatedSegments = 0) noexcept;
+
+
+    /** @brief Push a single element into the queue, never fails */
+    template<typename ...Args>
+    void push(Args &&...args) noexcept;
+
+
+    /** @brief Push a range of elements into the queue, never fails
+     *  Elements are moved into the queue and each segment is used once for all its claimed cells */
+    template<std::input_iterator InputIterator>
+    void pushRange(InputIterator from, const InputIterator to) noexcept;
+
+
+    /** @brief Pop a single element from the queue
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+    /** @brief Pop up to 'count' elements from the queue, each segment is used once for all its extracted cells
+     *  @return The number of extracted elements */
+    template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] std::size_t popRange(OutputIterator from, const OutputIterator to) noexcept;
+
+
+    /** @brief Clear all elements of the queue (unsafe) */
+    inline void clear(void) noexcept { for (Type tmp; pop(tmp);); }
+
+
+private:
+    alignas_cacheline std::atomic<Segment *> _tail {}; // Tail segment accessed by producers
+    alignas_cacheline std::atomic<Segment *> _head {}; // Head segment accessed by consumers
+    alignas_cacheline std::atomic<Segment *> _freeList {}; // Free list of recycled segments
+
+
+    /** @brief Copy and move constructors disabled */
+    UnboundedQueueDetails(const UnboundedQueueDetails &other) = delete;
+    UnboundedQueueDetails(UnboundedQueueDetails &&other) = delete;
+
+
+    /** @brief Acquire the segment pointed by 'source' */
+    [[nodiscard]] Segment *acquireSegment(const std::atomic<Segment *> &source) noexcept;
+
+    /** @brief Release an acquired segment */
+    void releaseSegment(Segment * const segment) noexcept;
+
+    /** @brief Move the tail past a full segment, linking a new segment if needed */
+    void advanceTail(Segment * const segment) noexcept;
+
+    /** @brief Move the head past an exhausted segment and retire it, then release the segment (multiple consumers)
+     *  @return False if there is no next segment, thus the queue is empty */
+    [[nodiscard]] bool advanceHead(Segment * const segment) noexcept;
+
+    /** @brief Mark a segment unreachable, it will be recycled as soon as no thread is using it */
+    void retireSegment(Segment * const segment) noexcept;
+
+    /** @brief Recycle a segment if it is retired and unused */
+    void tryRecycleSegment(Segment * const segment) noexcept;
+
+
+    /** @brief Get a segment from the free list or allocate it */
+    [[nodiscard]] Segment *makeSegment(void) noexcept;
+
+    /** @brief Store a chain of segments into the free list */
+    void recycleSegments(Segment * const first, Segment * const last) noexcept;
+
+    /** @brief Deallocate a segment */
+    static void DeallocateSegment(Segment * const segment) noexcept;
+};
+
+#include "UnboundedQueueDetails.ipp"
\ No newline at end of file
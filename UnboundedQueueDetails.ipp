@@ -0,0 +1,298 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded Queue Details
+ */
+
+#include "Abort.hpp"
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::~UnboundedQueueDetails(void) noexcept
+{
+    clear();
+    for (auto *segment = _head.load(std::memory_order_relaxed); segment;) {
+        const auto next = segment->next.load(std::memory_order_relaxed);
+        DeallocateSegment(segment);
+        segment = next;
+    }
+    for (auto *segment = _freeList.load(std::memory_order_relaxed); segment;) {
+        const auto next = segment->next.load(std::memory_order_relaxed);
+        DeallocateSegment(segment);
+        segment = next;
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::UnboundedQueueDetails(const std::size_t preallocatedSegments) noexcept
+{
+    for (auto i = 0ul; i != preallocatedSegments; ++i) {
+        auto * const segment = makeSegment();
+        recycleSegments(segment, segment);
+    }
+    auto * const segment = makeSegment();
+    _tail.store(segment, std::memory_order_relaxed);
+    _head.store(segment, std::memory_order_relaxed);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+template<typename ...Args>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::push(Args &&...args) noexcept
+{
+    while (true) {
+        auto * const segment = acquireSegment(_tail);
+        const auto index = segment->tail.fetch_add(1, std::memory_order_acq_rel);
+        if (index < SegmentCapacity) [[likely]] {
+            auto &cell = segment->cells[index];
+            new (&cell.data) Type(std::forward<Args>(args)...);
+            cell.ready.store(true, std::memory_order_release);
+            releaseSegment(segment);
+            return;
+        }
+        advanceTail(segment);
+        releaseSegment(segment);
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+template<std::input_iterator InputIterator>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::pushRange(InputIterator from, const InputIterator to) noexcept
+{
+    auto remaining = static_cast<std::size_t>(std::distance(from, to));
+
+    while (remaining) {
+        auto * const segment = acquireSegment(_tail);
+        // Claim every remaining cell at once, cells past the end of the segment are lost
+        const auto index = segment->tail.fetch_add(remaining, std::memory_order_acq_rel);
+        if (index < SegmentCapacity) [[likely]] {
+            const auto last = index + std::min(remaining, SegmentCapacity - index);
+            for (auto i = index; i != last; ++i, ++from) {
+                auto &cell = segment->cells[i];
+                new (&cell.data) Type(std::move(*from));
+                cell.ready.store(true, std::memory_order_release);
+            }
+            remaining -= last - index;
+            if (!remaining) [[likely]] {
+                releaseSegment(segment);
+                return;
+            }
+        }
+        advanceTail(segment);
+        releaseSegment(segment);
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline bool kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::pop(Type &value) noexcept
+{
+    while (true) {
+        Segment *segment;
+        if constexpr (MultipleConsumers)
+            segment = acquireSegment(_head);
+        else
+            segment = _head.load(std::memory_order_relaxed);
+        auto index = segment->head.load(std::memory_order_acquire);
+        while (index < SegmentCapacity) {
+            auto &cell = segment->cells[index];
+            // If the cell is not published, the queue is empty (or a producer is still inserting)
+            if (!cell.ready.load(std::memory_order_acquire)) [[unlikely]] {
+                if constexpr (MultipleConsumers)
+                    releaseSegment(segment);
+                return false;
+            }
+            if constexpr (MultipleConsumers) {
+                if (!segment->head.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel)) [[unlikely]]
+                    continue;
+            } else
+                segment->head.store(index + 1, std::memory_order_relaxed);
+            if constexpr (std::is_move_assignable_v<Type>)
+                value = std::move(cell.data);
+            else
+                value = cell.data;
+            cell.data.~Type();
+            if constexpr (MultipleConsumers)
+                releaseSegment(segment);
+            return true;
+        }
+        if (!advanceHead(segment))
+            return false;
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+inline std::size_t kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::popRange(OutputIterator from, const OutputIterator to) noexcept
+{
+    const auto requested = static_cast<std::size_t>(std::distance(from, to));
+    std::size_t popped = 0;
+
+    while (popped != requested) {
+        Segment *segment;
+        if constexpr (MultipleConsumers)
+            segment = acquireSegment(_head);
+        else
+            segment = _head.load(std::memory_order_relaxed);
+        auto index = segment->head.load(std::memory_order_acquire);
+        while (index < SegmentCapacity) {
+            // Count published cells, stopping at the first one that is not
+            const auto limit = std::min(SegmentCapacity, index + requested - popped);
+            auto last = index;
+            while (last != limit && segment->cells[last].ready.load(std::memory_order_acquire))
+                ++last;
+            if (last == index) [[unlikely]] {
+                if constexpr (MultipleConsumers)
+                    releaseSegment(segment);
+                return popped;
+            }
+            // Claim every published cell at once
+            if constexpr (MultipleConsumers) {
+                if (!segment->head.compare_exchange_weak(index, last, std::memory_order_acq_rel)) [[unlikely]]
+                    continue;
+            } else
+                segment->head.store(last, std::memory_order_relaxed);
+            for (auto i = index; i != last; ++i, ++from) {
+                auto &cell = segment->cells[i];
+                if constexpr (std::is_move_assignable_v<Type>)
+                    *from = std::move(cell.data);
+                else
+                    *from = cell.data;
+                cell.data.~Type();
+            }
+            popped += last - index;
+            if (popped == requested) {
+                if constexpr (MultipleConsumers)
+                    releaseSegment(segment);
+                return popped;
+            }
+            index = last;
+        }
+        if (!advanceHead(segment))
+            return popped;
+    }
+    return popped;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline typename kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::Segment *
+    kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::acquireSegment(const std::atomic<Segment *> &source) noexcept
+{
+    auto *segment = source.load(std::memory_order_acquire);
+    while (true) {
+        // The increment is ordered with the retirement of the segment as both modify 'users'
+        segment->users.fetch_add(1, std::memory_order_acquire);
+        // Ensure the segment is still reachable after being marked as used
+        const auto current = source.load(std::memory_order_acquire);
+        if (current == segment) [[likely]]
+            return segment;
+        releaseSegment(segment);
+        segment = current;
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::releaseSegment(Segment * const segment) noexcept
+{
+    if (segment->users.fetch_sub(1, std::memory_order_acq_rel) == RetiredFlag + 1) [[unlikely]]
+        tryRecycleSegment(segment);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::advanceTail(Segment * const segment) noexcept
+{
+    // Link a new segment if no other producer did it
+    auto *next = segment->next.load(std::memory_order_acquire);
+    if (!next) {
+        auto * const fresh = makeSegment();
+        if (segment->next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel))
+            next = fresh;
+        else
+            recycleSegments(fresh, fresh);
+    }
+    // Move tail to the next segment (may fail if another thread already did it)
+    auto expected = segment;
+    _tail.compare_exchange_strong(expected, next, std::memory_order_acq_rel);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline bool kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::advanceHead(Segment * const segment) noexcept
+{
+    // Segment is exhausted, if there is no next segment the queue is empty
+    auto * const next = segment->next.load(std::memory_order_acquire);
+    if (!next) {
+        if constexpr (MultipleConsumers)
+            releaseSegment(segment);
+        return false;
+    }
+    // Ensure tail does not point to the exhausted segment before retiring it
+    auto expected = segment;
+    _tail.compare_exchange_strong(expected, next, std::memory_order_acq_rel);
+    if constexpr (MultipleConsumers) {
+        expected = segment;
+        const bool owner = _head.compare_exchange_strong(expected, next, std::memory_order_acq_rel);
+        releaseSegment(segment);
+        if (owner)
+            retireSegment(segment);
+    } else {
+        _head.store(next, std::memory_order_release);
+        retireSegment(segment);
+    }
+    return true;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::retireSegment(Segment * const segment) noexcept
+{
+    if (!segment->users.fetch_add(RetiredFlag, std::memory_order_acq_rel))
+        tryRecycleSegment(segment);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::tryRecycleSegment(Segment * const segment) noexcept
+{
+    // Only a single thread can clear the retired flag of an unused segment
+    auto expected = RetiredFlag;
+    if (segment->users.compare_exchange_strong(expected, 0, std::memory_order_acq_rel))
+        recycleSegments(segment, segment);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline typename kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::Segment *
+    kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::makeSegment(void) noexcept
+{
+    // Steal the whole free list at once to prevent ABA issues of concurrent pops
+    auto * const segment = _freeList.exchange(nullptr, std::memory_order_acquire);
+
+    if (!segment) {
+        auto * const data = reinterpret_cast<Segment *>(Allocator::Allocate(sizeof(Segment), alignof(Segment)));
+        kFEnsure(data, "Core::UnboundedQueue: Allocation of segment failed");
+        return new (data) Segment {};
+    }
+    // Give back the remaining segments
+    if (auto * const first = segment->next.load(std::memory_order_relaxed); first) {
+        auto *last = first;
+        for (auto *next = last->next.load(std::memory_order_relaxed); next; next = last->next.load(std::memory_order_relaxed))
+            last = next;
+        recycleSegments(first, last);
+    }
+    // Reset the segment, 'users' is preserved as stale threads may still count on it
+    segment->tail.store(0, std::memory_order_relaxed);
+    segment->head.store(0, std::memory_order_relaxed);
+    segment->next.store(nullptr, std::memory_order_relaxed);
+    for (auto &cell : segment->cells)
+        cell.ready.store(false, std::memory_order_relaxed);
+    return segment;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::recycleSegments(Segment * const first, Segment * const last) noexcept
+{
+    auto head = _freeList.load(std::memory_order_relaxed);
+    do {
+        last->next.store(head, std::memory_order_relaxed);
+    } while (!_freeList.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, bool MultipleConsumers>
+inline void kF::Core::Internal::UnboundedQueueDetails<Type, Allocator, SegmentCapacity, MultipleConsumers>::DeallocateSegment(Segment * const segment) noexcept
+{
+    segment->~Segment();
+    Allocator::Deallocate(segment, sizeof(Segment), alignof(Segment));
+}
\ No newline at end of file
@@ -16,6 +16,10 @@
 
 #include "Platform.hpp"
 
+#if KUBE_COMPILER_MSVC
+# include <xmmintrin.h>
+#endif
+
 /** @brief Helper used to pass template into macro */
 #define TEMPLATE_TYPE(Class, ...) decltype(std::declval<Class<__VA_ARGS__>>())
 
@@ -130,6 +134,16 @@ namespace kF::Core
     inline void AlignedFree(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
         { ::operator delete(data, bytes, static_cast<std::align_val_t>(alignment)); }
 
+    /** @brief Hint the processor to fetch a memory location into cache for reading */
+    inline void Prefetch(const void * const address) noexcept
+    {
+#if KUBE_COMPILER_MSVC
+        _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+        __builtin_prefetch(address, 0, 3);
+#endif
+    }
+
 
     /** @brief Concept of an allocator */
     template<typename Type>
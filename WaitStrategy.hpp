@@ -0,0 +1,46 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Wait strategies
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+namespace kF::Core
+{
+    /** @brief Requirements of a wait strategy
+     *  'Wait' returns when 'value' may differ from 'old', 'Notify' wakes up threads waiting over 'value' */
+    template<typename Type>
+    concept WaitStrategyRequirements = requires(std::atomic<std::size_t> &value, const std::size_t old)
+    {
+        Type::Wait(value, old);
+        Type::Notify(value);
+    };
+
+    /** @brief Busy spin wait strategy, lowest latency at the cost of a dedicated core */
+    struct BusySpinWaitStrategy
+    {
+        static inline void Wait(const std::atomic<std::size_t> &, const std::size_t) noexcept {}
+        static inline void Notify(std::atomic<std::size_t> &) noexcept {}
+    };
+
+    /** @brief Yield wait strategy, gives the core back to the OS scheduler on each wait */
+    struct YieldWaitStrategy
+    {
+        static inline void Wait(const std::atomic<std::size_t> &, const std::size_t) noexcept { std::this_thread::yield(); }
+        static inline void Notify(std::atomic<std::size_t> &) noexcept {}
+    };
+
+    /** @brief Futex wait strategy, waiting threads sleep until notified (atomic wait / notify) */
+    struct FutexWaitStrategy
+    {
+        static inline void Wait(const std::atomic<std::size_t> &value, const std::size_t old) noexcept { value.wait(old, std::memory_order_acquire); }
+        static inline void Notify(std::atomic<std::size_t> &value) noexcept { value.notify_all(); }
+    };
+
+    static_assert(WaitStrategyRequirements<BusySpinWaitStrategy>, "BusySpinWaitStrategy doesn't meet requirements");
+    static_assert(WaitStrategyRequirements<YieldWaitStrategy>, "YieldWaitStrategy doesn't meet requirements");
+    static_assert(WaitStrategyRequirements<FutexWaitStrategy>, "FutexWaitStrategy doesn't meet requirements");
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work stealing deque
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    class WorkStealingDeque;
+}
+
+/**
+ * @brief The work stealing deque is a lock-free Chase-Lev deque with a fixed capacity
+ * A single owner thread can push / pop at the bottom of the deque (LIFO) while any other thread can steal at its top (FIFO)
+ *
+ * @tparam Type to be inserted (must be trivially copyable, usually a pointer)
+ * @tparam Allocator Static allocator
+ */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class alignas_double_cacheline kF::Core::WorkStealingDeque
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type>, "Core::WorkStealingDeque: Type must be trivially copyable");
+
+    /** @brief Each cell can be read by a thief while being written by the owner */
+    using Cell = std::atomic<Type>;
+
+    /** @brief Buffer structure containing all cells */
+    struct Buffer
+    {
+        Cell *data {};
+        std::int64_t mask { 0 };
+    };
+
+
+    /** @brief Destruct and release all memory */
+    ~WorkStealingDeque(void) noexcept;
+
+    /** @brief Default constructor initialize the deque, 'capacity' must be a power of 2 */
+    WorkStealingDeque(const std::size_t capacity) noexcept;
+
+
+    /** @brief Push a single element at the bottom of the deque (owner only)
+     *  @return true if the element has been inserted */
+    [[nodiscard]] bool push(const Type value) noexcept;
+
+    /** @brief Pop a single element from the bottom of the deque (owner only)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+    /** @brief Steal a single element from the top of the deque (any thread)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool steal(Type &value) noexcept;
+
+
+    /** @brief Get the size of the deque (approximative) */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+    /** @brief Get the capacity of the deque */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return static_cast<std::size_t>(_buffer.mask + 1); }
+
+
+private:
+    alignas_cacheline std::atomic<std::int64_t> _top { 0 }; // Top accessed by thieves and owner
+    alignas_cacheline std::atomic<std::int64_t> _bottom { 0 }; // Bottom accessed by owner and thieves
+    alignas_cacheline Buffer _buffer {}; // Buffer is constant after construction
+
+
+    /** @brief Copy and move constructors disabled */
+    WorkStealingDeque(const WorkStealingDeque &other) = delete;
+    WorkStealingDeque(WorkStealingDeque &&other) = delete;
+};
+
+#include "WorkStealingDeque.ipp"
\ No newline at end of file
@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work stealing deque
+ */
+
+#include "Abort.hpp"
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::WorkStealingDeque<Type, Allocator>::~WorkStealingDeque(void) noexcept
+{
+    std::destroy_n(_buffer.data, capacity());
+    Allocator::Deallocate(_buffer.data, sizeof(Cell) * capacity(), alignof(Cell));
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::WorkStealingDeque<Type, Allocator>::WorkStealingDeque(const std::size_t capacity) noexcept
+    : _buffer(Buffer { nullptr, static_cast<std::int64_t>(capacity) - 1 })
+{
+    kFEnsure((capacity >= 2) && (capacity & (capacity - 1ul)) == 0, // Ensure capacity is  a power of two >= 2
+        "Core::WorkStealingDeque: Buffer capacity must be a power of 2 (", capacity, ')');
+    _buffer.data = reinterpret_cast<Cell *>(Allocator::Allocate(sizeof(Cell) * capacity, alignof(Cell)));
+    kFEnsure(_buffer.data, // Ensure allocation succeed
+        "Core::WorkStealingDeque: Allocation of capacity ", capacity, " failed");
+    for (auto i = 0ul; i != capacity; ++i)
+        new (&_buffer.data[i]) Cell();
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::push(const Type value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+
+    if (bottom - top > _buffer.mask) [[unlikely]]
+        return false;
+    _buffer.data[bottom & _buffer.mask].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::pop(Type &value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+
+    // Reserve the bottom element before checking thieves
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+    if (top > bottom) [[unlikely]] {
+        // Deque is empty
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    value = _buffer.data[bottom & _buffer.mask].load(std::memory_order_relaxed);
+    if (top != bottom) [[likely]]
+        return true;
+    // Last element, race against thieves
+    const bool success = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return success;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::steal(Type &value) noexcept
+{
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) [[unlikely]]
+        return false;
+    const auto tmp = _buffer.data[top & _buffer.mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) [[unlikely]]
+        return false;
+    value = tmp;
+    return true;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::WorkStealingDeque<Type, Allocator>::size(void) const noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0ul;
+}
\ No newline at end of file